@@ -4,6 +4,7 @@
 #include <boost/log/trivial.hpp>
 #include <boost/program_options.hpp>
 #include <chrono>
+#include <csignal>
 #include <cstdlib>
 #include <gurobi_c++.h>
 #include <iostream>
@@ -14,12 +15,16 @@ namespace logging = boost::log;
 using namespace boost::program_options;
 namespace po = boost::program_options;
 
+/// Stops the solver as on a time limit, so that the best profile is written
+extern "C" void stopOnSignal(int) { Game::EPEC::requestStop(); }
+
 int main(int argc, char **argv) {
   string resFile, instanceFile = "", logFile;
   int writeLevel, nThreads, verbosity, bigM, algorithm, aggressiveness, add{0},
-      recover;
-  double timeLimit, boundBigM;
-  bool bound, pure;
+      recover, devnPool, masterPool, hullCache, expand, cuts, dynamics, rounds,
+      decompose;
+  double timeLimit, boundBigM, continuation, epsilon;
+  bool bound, pure, twoPhase, pipelined, masterStart, prune, adaptive;
 
   po::options_description desc("EPEC: Allowed options");
   desc.add_options()("help,h", "Shows this help message")("version,v",
@@ -33,9 +38,11 @@ int main(int argc, char **argv) {
       "recover,r", po::value<int>(&recover)->default_value(0),
       "If innerApproximation is used along with pureNE, which strategy should "
       "be used to retrive a pure NE. 0: incrementalEnumeration, "
-      "1:combinatorialPNE")("algorithm,a", po::value<int>(&algorithm),
+      "1:combinatorialPNE, 2:supportReduction")("algorithm,a", po::value<int>(&algorithm),
                             "Sets the algorithm. 0: fullEnumeration, "
-                            "1:innerApproximation, 2:combinatorialPNE")(
+                            "1:innerApproximation, 2:combinatorialPNE, "
+                            "3:portfolio, 4:outerApproximation, "
+                            "5:bestResponseDynamics")(
       "solution,s", po::value<string>(&resFile)->default_value("dat/Solution"),
       "Sets the output path/filename of the solution file (.json appended "
       "automatically)")(
@@ -62,7 +69,57 @@ int main(int argc, char **argv) {
       "Set the bounding bigM related to the parameter --bound")(
       "add,ad", po::value<int>(&add)->default_value(0),
       "Sets the EPECAddPolyMethod for the innerApproximation. 0: sequential. "
-      "1: reverse_sequential. 2:random.");
+      "1: reverse_sequential. 2:random. 3:guided.")(
+      "twophase,tp", po::value<bool>(&twoPhase)->default_value(false),
+      "Controls whether the innerApproximation should seek deviations in the "
+      "known feasible polyhedra before solving the full best response MIP.")(
+      "devnpool,dp", po::value<int>(&devnPool)->default_value(1),
+      "Sets the maximum number of improving deviations harvested from the "
+      "solution pool of each best response in the innerApproximation. (int)")(
+      "masterpool,mp", po::value<int>(&masterPool)->default_value(1),
+      "Sets the maximum number of master LCP solutions from which deviations "
+      "are computed in the innerApproximation. (int)")(
+      "pipelined,pl", po::value<bool>(&pipelined)->default_value(false),
+      "Controls whether the innerApproximation should run the best response "
+      "and the convex hull of each country as concurrent tasks.")(
+      "masterstart,ms", po::value<bool>(&masterStart)->default_value(false),
+      "Controls whether each master LCP is given the previous equilibrium as "
+      "a MIP start.")(
+      "prune,pr", po::value<bool>(&prune)->default_value(false),
+      "Controls whether the combinatorialPNE algorithm should discard partial "
+      "combinations whose relaxation is infeasible.")(
+      "hullcache,hc", po::value<int>(&hullCache)->default_value(0),
+      "Sets the maximum number of convex hulls memoized per country. 0 "
+      "disables the cache. The cap counts hulls, not bytes. (int)")(
+      "adaptive,aa", po::value<bool>(&adaptive)->default_value(false),
+      "Controls whether the innerApproximation should tune the "
+      "aggressiveness of each country at run time, starting from --aggr.")(
+      "continuation,ct", po::value<double>(&continuation)->default_value(1),
+      "Sets the factor by which the innerApproximation loosens the tolerance "
+      "and the MIP gaps of its first iterations. 1 disables the "
+      "continuation. (double)")(
+      "epsilon,eps", po::value<double>(&epsilon)->default_value(-1),
+      "If positive, the innerApproximation stops at an epsilon-Nash "
+      "equilibrium, namely as soon as the regret of each country is "
+      "certified to be at most this value. (double)")(
+      "expand,ex", po::value<int>(&expand)->default_value(0),
+      "Sets the maximum number of polyhedra next to the support and the "
+      "deviations added per country and iteration of the "
+      "innerApproximation. 0 disables the expansion. (int)")(
+      "cuts,cu", po::value<int>(&cuts)->default_value(0),
+      "Sets the maximum number of disjunctive cuts kept per country by the "
+      "outerApproximation. 0 disables the cuts. (int)")(
+      "dynamics,dy", po::value<int>(&dynamics)->default_value(0),
+      "Sets the update scheme of the bestResponseDynamics. 0: Gauss-Seidel. "
+      "1: Jacobi.")(
+      "rounds,ro", po::value<int>(&rounds)->default_value(50),
+      "Sets the maximum number of profiles visited by the "
+      "bestResponseDynamics before the innerApproximation takes over. 0 "
+      "means no limit. (int)")(
+      "decompose,dc", po::value<int>(&decompose)->default_value(0),
+      "Sets the maximum number of rounds of price coordination across the "
+      "countries tried before solving each master LCP as one MIP. 0 disables "
+      "the decomposition. (int)");
 
   po::variables_map vm;
   po::store(po::parse_command_line(argc, argv, desc), vm);
@@ -149,6 +206,18 @@ int main(int argc, char **argv) {
     epec.setBoundBigM(boundBigM);
   }
 
+  // MIP start for the master LCP
+  if (masterStart)
+    epec.setMasterMIPStart(true);
+  // Memoized convex hulls
+  if (hullCache > 0)
+    epec.setHullCacheSize(hullCache);
+  if (decompose > 0)
+    epec.setMasterDecomposition(decompose);
+  // Pruning of the combinatorialPNE
+  if (prune)
+    epec.setCombinatorialPruning(true);
+
   // Algorithm
 
   switch (algorithm) {
@@ -156,6 +225,12 @@ int main(int argc, char **argv) {
     epec.setAlgorithm(Game::EPECalgorithm::innerApproximation);
     if (aggressiveness != 1)
       epec.setAggressiveness(aggressiveness);
+    if (adaptive)
+      epec.setAdaptiveAggressiveness(true);
+    if (continuation > 1)
+      epec.setContinuationStart(continuation);
+    if (epsilon > 0)
+      epec.setEpsilon(epsilon);
     switch (add) {
     case 1:
       epec.setAddPolyMethod(EPECAddPolyMethod::reverse_sequential);
@@ -163,17 +238,58 @@ int main(int argc, char **argv) {
     case 2:
       epec.setAddPolyMethod(EPECAddPolyMethod::random);
       break;
+    case 3:
+      epec.setAddPolyMethod(EPECAddPolyMethod::guided);
+      break;
     default:
       epec.setAddPolyMethod(EPECAddPolyMethod::sequential);
     }
-    if (recover != 0)
+    switch (recover) {
+    case 1:
       epec.setRecoverStrategy(EPECRecoverStrategy::combinatorial);
+      break;
+    case 2:
+      epec.setRecoverStrategy(EPECRecoverStrategy::supportReduction);
+      break;
+    default:
+      break;
+    }
+    if (twoPhase)
+      epec.setTwoPhaseResponse(true);
+    if (devnPool > 1)
+      epec.setDevnPoolSize(devnPool);
+    if (masterPool > 1)
+      epec.setMasterPoolSize(masterPool);
+    if (pipelined)
+      epec.setPipelined(true);
+    if (expand > 0)
+      epec.setNeighbourExpansion(expand);
     break;
   }
   case 2: {
     epec.setAlgorithm(Game::EPECalgorithm::combinatorialPNE);
     break;
   }
+  case 3: {
+    epec.setAlgorithm(Game::EPECalgorithm::portfolio);
+    break;
+  }
+  case 4: {
+    epec.setAlgorithm(Game::EPECalgorithm::outerApproximation);
+    if (aggressiveness != 1)
+      epec.setAggressiveness(aggressiveness);
+    if (cuts > 0)
+      epec.setDisjunctiveCuts(cuts);
+    break;
+  }
+  case 5: {
+    epec.setAlgorithm(Game::EPECalgorithm::bestResponseDynamics);
+    if (dynamics == 1)
+      epec.setDynamics(Game::EPECDynamics::jacobi);
+    if (rounds >= 0)
+      epec.setDynamicsRounds(rounds);
+    break;
+  }
   default:
     epec.setAlgorithm(Game::EPECalgorithm::fullEnumeration);
   }
@@ -184,6 +300,8 @@ int main(int argc, char **argv) {
     epec.addCountry(Instance.Countries.at(j));
   epec.addTranspCosts(Instance.TransportationCosts);
   epec.finalize();
+  std::signal(SIGINT, stopOnSignal);
+  std::signal(SIGTERM, stopOnSignal);
   // epec.make_country_QP();
   try {
     epec.findNashEq();
@@ -203,7 +321,19 @@ int main(int argc, char **argv) {
   // WRITING STATISTICS AND SOLUTION
   // --------------------------------
   Game::EPECStatistics stat = epec.getStatistics();
-  if (stat.status == Game::EPECsolveStatus::nashEqFound)
+  if (!stat.aggressivenessLog.empty()) {
+    stringstream levels;
+    for (const auto &iteration : stat.aggressivenessLog) {
+      levels << "[";
+      for (const unsigned int level : iteration)
+        levels << " " << level;
+      levels << " ]";
+    }
+    BOOST_LOG_TRIVIAL(info) << "Aggressiveness per iteration: "
+                            << levels.str();
+  }
+  if (stat.status == Game::EPECsolveStatus::nashEqFound ||
+      (stat.status == Game::EPECsolveStatus::timeLimit && epec.hasIncumbent()))
     epec.writeSolution(writeLevel, resFile);
   ifstream existCheck(logFile);
   std::ofstream results(logFile, ios::app);
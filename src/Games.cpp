@@ -2,11 +2,22 @@
 #include <algorithm>
 #include <armadillo>
 #include <array>
+#include <atomic>
+#include <boost/functional/hash.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/program_options.hpp>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <thread>
+#include <tuple>
+#include <unordered_set>
 
 using namespace std;
 using namespace Utils;
@@ -365,6 +376,8 @@ unique_ptr<GRBModel> Game::QP_Param::solveFixed(
     model->update();
     model->set(GRB_IntParam_NonConvex, 2);
     model->set(GRB_IntParam_OutputFlag, 0);
+    if (this->deadline)
+      this->deadline->apply(*model);
     model->optimize();
   } catch (const char *e) {
     cerr << " Error in Game::QP_Param::solveFixed: " << e << '\n';
@@ -1193,6 +1206,8 @@ bool Game::NashGame::isSolved(const arma::vec &sol, unsigned int &violPlayer,
 
 // EPEC stuff
 
+std::atomic<bool> Game::EPEC::stopFlag{false};
+
 void Game::EPEC::prefinalize()
 /**
   @brief Empty function - optionally reimplementable in derived class
@@ -1215,13 +1230,18 @@ void Game::EPEC::resetLCP() {
   /**
    * Resets the LCP objects to blank objects with no polyhedron added.
    * Useful in testing, or resolving a problem with a different algorithm.
+   * As in Game::EPEC::finalize, each LCP lives in its country's environment
+   * (see Game::EPEC::getCountryEnv). The last equilibrium refers to the
+   * polyhedra dropped, hence it is discarded too.
    */
   BOOST_LOG_TRIVIAL(warning) << "Game::EPEC::resetLCP: resetting LCPs.";
+  this->nashEq = false;
   for (unsigned int i = 0; i < this->nCountr; ++i) {
     if (this->countries_LCP.at(i))
       this->countries_LCP.at(i).reset();
     this->countries_LCP.at(i) = std::unique_ptr<Game::LCP>(
-        new LCP(this->env, *this->countries_LL.at(i).get()));
+        new LCP(this->getCountryEnv(i), *this->countries_LL.at(i).get()));
+    this->countries_LCP.at(i)->deadline = &this->deadline;
   }
 }
 
@@ -1248,6 +1268,11 @@ void Game::EPEC::finalize()
     this->convexHullVariables = std::vector<unsigned int>(this->nCountr, 0);
     BOOST_LOG_TRIVIAL(trace) << "Finalizing...";
     this->Stats.feasiblePolyhedra = std::vector<unsigned int>(this->nCountr, 0);
+    this->Stats.knownPolyDevns = std::vector<unsigned int>(this->nCountr, 0);
+    this->Stats.pooledDevns = std::vector<unsigned int>(this->nCountr, 0);
+    this->Stats.hullCacheHits = std::vector<unsigned int>(this->nCountr, 0);
+    this->Stats.hullCacheMisses = std::vector<unsigned int>(this->nCountr, 0);
+    this->hullCache = std::vector<std::list<HullCacheEntry>>(this->nCountr);
     this->computeLeaderLocations(this->n_MCVar);
     // Initialize leader objective and country_QP
     this->LeadObjec = vector<shared_ptr<Game::QP_objective>>(nCountr);
@@ -1256,6 +1281,21 @@ void Game::EPEC::finalize()
     this->country_QP = vector<shared_ptr<Game::QP_Param>>(nCountr);
     this->countries_LCP = vector<unique_ptr<Game::LCP>>(nCountr);
     this->SizesWithoutHull = vector<unsigned int>(nCountr, 0);
+    this->countryEnvs.clear();
+    if (this->Stats.AlgorithmParam.pipelined) {
+      // Gurobi environments are not thread safe: each country task needs its
+      // own. The threads are split among the countries.
+      const unsigned int totThreads =
+          this->Stats.AlgorithmParam.threads > 0
+              ? this->Stats.AlgorithmParam.threads
+              : std::thread::hardware_concurrency();
+      const int countryThreads =
+          std::max(1, static_cast<int>(totThreads / this->nCountr));
+      for (unsigned int i = 0; i < this->nCountr; i++) {
+        this->countryEnvs.push_back(std::unique_ptr<GRBEnv>(new GRBEnv()));
+        this->countryEnvs.back()->set(GRB_IntParam_Threads, countryThreads);
+      }
+    }
     for (unsigned int i = 0; i < this->nCountr; i++) {
       BOOST_LOG_TRIVIAL(trace) << "Finalizing country " << i;
       this->add_Dummy_Lead(i);
@@ -1263,7 +1303,8 @@ void Game::EPEC::finalize()
       this->LeadObjec_ConvexHull.at(i) = std::make_shared<Game::QP_objective>();
       this->make_obj_leader(i, *this->LeadObjec.at(i).get());
       this->countries_LCP.at(i) = std::unique_ptr<Game::LCP>(
-          new LCP(this->env, *this->countries_LL.at(i).get()));
+          new LCP(this->getCountryEnv(i), *this->countries_LL.at(i).get()));
+      this->countries_LCP.at(i)->deadline = &this->deadline;
       this->SizesWithoutHull.at(i) = *this->LocEnds.at(i);
     }
     BOOST_LOG_TRIVIAL(trace) << "Finalized";
@@ -1365,7 +1406,15 @@ void EPEC::get_x_minus_i(const arma::vec &x, const unsigned int &i,
 }
 
 unique_ptr<GRBModel> Game::EPEC::Respond(const unsigned int i,
-                                         const arma::vec &x) const {
+                                         const arma::vec &x, bool solve,
+                                         Game::LCP *lcp) const {
+  /**
+   * @brief Best response MIQP of country @p i against the other countries'
+   * strategies in @p x
+   * @details The MIQP is made on @p lcp, if not null, instead of the country's
+   * own Game::LCP. This lets concurrent tasks build the responses on copies
+   * that live in their own Gurobi environment.
+   */
   if (!this->finalized)
     throw string("Error in Game::EPEC::Respond: Model not finalized");
 
@@ -1374,17 +1423,218 @@ unique_ptr<GRBModel> Game::EPEC::Respond(const unsigned int i,
 
   arma::vec solOther;
   this->get_x_minus_i(x, i, solOther);
-  return this->countries_LCP.at(i).get()->MPECasMIQP(
+  if (!lcp)
+    lcp = this->countries_LCP.at(i).get();
+  auto model = lcp->MPECasMIQP(
       this->LeadObjec.at(i)->Q, this->LeadObjec.at(i)->C,
-      this->LeadObjec.at(i)->c, solOther, true);
+      this->LeadObjec.at(i)->c, solOther, false);
+  if (this->currentMIPGap() > 0)
+    model->set(GRB_DoubleParam_MIPGap, this->currentMIPGap());
+  if (solve)
+    model->optimize();
+  return model;
+}
+
+namespace {
+/// @brief The dual bound of a best response solved to optimality, i.e., a
+/// lower bound on its optimal value even within the MIP gap
+double responseBound(GRBModel &model) {
+  return model.get(GRB_IntAttr_IsMIP) ? model.get(GRB_DoubleAttr_ObjBound)
+                                      : model.get(GRB_DoubleAttr_ObjVal);
+}
+} // namespace
+
+double Game::EPEC::certifyRegret(
+    std::vector<arma::vec> *devns ///< [out] If not null, the response that
+                                  ///< proves a regret above the tolerances
+                                  ///< (empty for the other countries)
+) {
+  /**
+   * @brief Bounds the regret of each country at Game::EPEC::sol_x
+   * @details The regret of a country is its objective at Game::EPEC::sol_x
+   * minus the objective of its best response. The dual bound of the best
+   * response MIQP gives an upper bound on it. Gurobi stops as soon as this
+   * bound proves that the regret is at most
+   * Game::EPECAlgorithmParams::epsilon, or as soon as a response proves that
+   * it is not. In the latter case, the remaining countries are not checked.
+   * The bounds are stored in Game::EPECStatistics::certifiedRegret.
+   * If the response improves by more than Game::EPEC::currentSolvedTol as
+   * well, it is a profitable deviation, and it is returned in @p devns so
+   * that Game::EPEC::iterativeNash does not solve that MIQP again.
+   * @returns The largest bound, GRB_INFINITY if some regret is not bounded
+   */
+  const double eps = this->Stats.AlgorithmParam.epsilon;
+  this->Stats.certifiedRegret =
+      std::vector<double>(this->nCountr, GRB_INFINITY);
+  if (devns)
+    *devns = std::vector<arma::vec>(this->nCountr);
+  if (!this->nashgame || !this->nashEq)
+    return GRB_INFINITY;
+  const arma::vec objvals =
+      this->nashgame->ComputeQPObjvals(this->sol_x, true);
+  double maxRegret{0};
+  for (unsigned int i = 0; i < this->nCountr; ++i) {
+    auto model = this->Respond(i, this->sol_x, false);
+    model->set(GRB_DoubleParam_BestBdStop, objvals.at(i) - eps);
+    model->set(GRB_DoubleParam_BestObjStop, objvals.at(i) - eps);
+    model->optimize();
+    const int status = model->get(GRB_IntAttr_Status);
+    double bound{-GRB_INFINITY};
+    if (model->get(GRB_IntAttr_IsMIP)) {
+      if (status == GRB_OPTIMAL || status == GRB_USER_OBJ_LIMIT ||
+          status == GRB_TIME_LIMIT || status == GRB_SUBOPTIMAL)
+        bound = model->get(GRB_DoubleAttr_ObjBound);
+    } else if (status == GRB_OPTIMAL)
+      bound = model->get(GRB_DoubleAttr_ObjVal);
+    const double regret = bound <= -GRB_INFINITY
+                              ? GRB_INFINITY
+                              : std::max(0.0, objvals.at(i) - bound);
+    this->Stats.certifiedRegret.at(i) = regret;
+    maxRegret = std::max(maxRegret, regret);
+    BOOST_LOG_TRIVIAL(debug) << "Game::EPEC::certifyRegret: country " << i
+                             << " regret at most " << regret;
+    if (regret > eps) {
+      const double threshold =
+          objvals.at(i) - std::max(eps, this->currentSolvedTol());
+      if (devns && model->get(GRB_IntAttr_SolCount) > 0 &&
+          model->get(GRB_DoubleAttr_ObjVal) < threshold) {
+        const unsigned int Nx = this->countries_LCP.at(i)->getNcol();
+        devns->at(i).zeros(Nx);
+        for (unsigned int j = 0; j < Nx; ++j)
+          devns->at(i).at(j) =
+              model->getVarByName("x_" + to_string(j)).get(GRB_DoubleAttr_X);
+      }
+      break;
+    }
+  }
+  arma::vec MC{};
+  const auto leadFoll = this->getLeadFoll(this->sol_x, MC);
+  this->updateIncumbent(leadFoll, MC, this->Stats.certifiedRegret);
+  return maxRegret;
+}
+
+std::vector<arma::vec> Game::EPEC::getLeadFoll(const arma::vec &x,
+                                               arma::vec &MC) const {
+  /**
+   * @brief Reads each country's own variables and the market clearing
+   * variables in @p x, in a form that does not depend on the layout of the
+   * master LCP (as in Game::EPEC::saveMasterStart)
+   * @p MC is filled with the market clearing variables
+   */
+  std::vector<arma::vec> leadFoll(this->nCountr);
+  for (unsigned int i = 0; i < this->nCountr; ++i) {
+    const unsigned int nC = this->countries_LCP.at(i)->getNcol();
+    leadFoll.at(i) = x.subvec(this->LeaderLocations.at(i),
+                              this->LeaderLocations.at(i) + nC - 1);
+  }
+  MC.zeros(this->n_MCVar);
+  for (unsigned int j = 0; j < this->n_MCVar; j++)
+    MC.at(j) = x.at(this->nVarinEPEC - this->n_MCVar + j);
+  return leadFoll;
+}
+
+void Game::EPEC::updateIncumbent(const std::vector<arma::vec> &leadFoll,
+                                 const arma::vec &MC,
+                                 const std::vector<double> &regret) {
+  /**
+   * @brief Keeps the profile given by @p leadFoll and @p MC as the incumbent
+   * if its largest regret in @p regret is lower than the incumbent's one
+   * @details The incumbent is the best profile seen by any algorithm, and it
+   * is what Game::EPEC::getIncumbent returns when no equilibrium was found.
+   * Profiles with some unknown regret (GRB_INFINITY) are ignored. Workers may
+   * call this concurrently.
+   */
+  if (regret.size() != this->nCountr)
+    return;
+  const double maxRegret = *std::max_element(regret.begin(), regret.end());
+  if (maxRegret >= GRB_INFINITY)
+    return;
+  std::lock_guard<std::mutex> lock(this->incumbentMutex);
+  if (!this->Stats.incumbentRegret.empty() &&
+      maxRegret >= *std::max_element(this->Stats.incumbentRegret.begin(),
+                                     this->Stats.incumbentRegret.end()))
+    return;
+  this->incumbentLeadFoll = leadFoll;
+  this->incumbentMC = MC;
+  this->Stats.incumbentRegret = regret;
+  BOOST_LOG_TRIVIAL(debug) << "Game::EPEC::updateIncumbent: new incumbent "
+                              "with regret at most "
+                           << maxRegret;
+}
+
+double Game::EPEC::incumbentMaxRegret() const {
+  /**
+   * @brief The largest regret of a country at the incumbent, GRB_INFINITY if
+   * there is none
+   */
+  std::lock_guard<std::mutex> lock(this->incumbentMutex);
+  if (this->Stats.incumbentRegret.empty())
+    return GRB_INFINITY;
+  return *std::max_element(this->Stats.incumbentRegret.begin(),
+                           this->Stats.incumbentRegret.end());
+}
+
+bool Game::EPEC::hasIncumbent() const {
+  std::lock_guard<std::mutex> lock(this->incumbentMutex);
+  return this->incumbentLeadFoll.size() == this->nCountr;
+}
+
+arma::vec Game::EPEC::getIncumbent() const {
+  /**
+   * @brief The incumbent, i.e., the profile with the lowest maximum regret
+   * seen so far, laid out as Game::EPEC::getx
+   * @details Convex hull variables are set to zero, since the polyhedra of
+   * the incumbent may no longer be in the inner approximation. The regret of
+   * each country is in Game::EPECStatistics::incumbentRegret.
+   */
+  std::lock_guard<std::mutex> lock(this->incumbentMutex);
+  arma::vec x(this->nVarinEPEC, arma::fill::zeros);
+  if (this->incumbentLeadFoll.size() != this->nCountr)
+    return x;
+  for (unsigned int i = 0; i < this->nCountr; ++i) {
+    const arma::vec &leadFoll = this->incumbentLeadFoll.at(i);
+    for (unsigned int j = 0; j < leadFoll.n_elem; ++j)
+      x.at(this->LeaderLocations.at(i) + j) = leadFoll.at(j);
+  }
+  for (unsigned int j = 0; j < this->incumbentMC.n_elem; j++)
+    x.at(this->nVarinEPEC - this->n_MCVar + j) = this->incumbentMC.at(j);
+  return x;
+}
+
+double Game::EPEC::currentSolvedTol() const {
+  /**
+   * @brief Game::EPECAlgorithmParams::solvedTol, loosened by the current
+   * factor of the tolerance continuation (see
+   * Game::EPECAlgorithmParams::continuationStart)
+   */
+  return this->Stats.AlgorithmParam.solvedTol * this->continuationFactor;
+}
+
+double Game::EPEC::currentMIPGap() const {
+  /**
+   * @brief The relative MIP gap of the best responses and of the master LCP
+   * during the tolerance continuation
+   * @returns Gurobi's default gap loosened by the current factor, up to 10%,
+   * or -1 if the continuation is over and Gurobi's setting applies
+   */
+  if (this->continuationFactor <= 1)
+    return -1;
+  return std::min(0.1, 1e-4 * this->continuationFactor);
 }
 double Game::EPEC::RespondSol(
     arma::vec &sol,      ///< [out] Optimal response
     unsigned int player, ///< Player whose optimal response is to be computed
     const arma::vec &x, ///< A vector of pure strategies (either for all players
     ///< or all other players
-    const arma::vec &prevDev = {}
+    const arma::vec &prevDev = {},
     //< [in] if any, the vector of previous deviations.
+    std::vector<arma::vec>
+        *pool, ///< [out] If not null, improving solutions other than the
+               ///< optimal one are harvested from the solution pool
+    double poolThreshold, ///< Pool solutions are improving only if their
+                          ///< objective is smaller than this value
+    double *bound ///< [out] If not null, the dual bound of the response
+                  ///< (-GRB_INFINITY if unknown)
 ) const {
   /**
    * @brief Returns the optimal objective value that is obtainable for the
@@ -1393,12 +1643,32 @@ double Game::EPEC::RespondSol(
    * Calls Game::EPEC::Respond and obtains the unique_ptr to GRBModel of
    * best response by player @p player. Then solves the model and returns the
    * appropriate objective value.
+   * If @p pool is not null and Game::EPECAlgorithmParams::devnPoolSize is
+   * greater than 1, up to that many solutions are kept in Gurobi's solution
+   * pool, and the improving ones are returned in @p pool (see
+   * Game::EPEC::harvestDevnPool).
+   * Under a MIP gap or a time limit, the returned value may exceed the optimal
+   * one, while @p bound never does.
    * @returns The optimal objective value for the player @p player.
    */
-  auto model = this->Respond(player, x);
-  BOOST_LOG_TRIVIAL(trace) << "Game::EPEC::RespondSol: Writing dat/RespondSol" +
-                                  std::to_string(player) + ".lp to disk";
-  model->write("dat/RespondSol" + std::to_string(player) + ".lp");
+  if (bound)
+    *bound = -GRB_INFINITY;
+  const bool harvest =
+      pool != nullptr && this->Stats.AlgorithmParam.devnPoolSize > 1;
+  auto model = this->Respond(player, x, !harvest);
+  if (harvest) {
+    model->set(GRB_IntParam_PoolSolutions,
+               this->Stats.AlgorithmParam.devnPoolSize);
+    model->set(GRB_IntParam_PoolSearchMode, 1);
+    model->optimize();
+  }
+  // Concurrent runs of the portfolio would write the same file
+  if (!this->racing) {
+    BOOST_LOG_TRIVIAL(trace)
+        << "Game::EPEC::RespondSol: Writing dat/RespondSol" +
+               std::to_string(player) + ".lp to disk";
+    model->write("dat/RespondSol" + std::to_string(player) + ".lp");
+  }
   const int status = model->get(GRB_IntAttr_Status);
   if (status == GRB_UNBOUNDED || status == GRB_OPTIMAL) {
     unsigned int Nx = this->countries_LCP.at(player)->getNcol();
@@ -1443,6 +1713,10 @@ double Game::EPEC::RespondSol(
       }
     }
     if (status == GRB_OPTIMAL) {
+      if (harvest)
+        this->harvestDevnPool(model.get(), player, poolThreshold, *pool);
+      if (bound)
+        *bound = responseBound(*model);
       return model->get(GRB_DoubleAttr_ObjVal);
     }
   } else {
@@ -1451,6 +1725,89 @@ double Game::EPEC::RespondSol(
   return GRB_INFINITY;
 }
 
+void Game::EPEC::harvestDevnPool(
+    GRBModel *model,     ///< A solved best response model
+    unsigned int player, ///< Player whose best response @p model is
+    const double threshold, ///< Only solutions whose objective is smaller than
+                            ///< this value are harvested
+    std::vector<arma::vec> &pool ///< [out] Where the solutions are stored
+) const {
+  /**
+   * @brief Harvests improving deviations from the solution pool of a best
+   * response model.
+   * @details Solution 0 is the optimal response, and it is already returned by
+   * Game::EPEC::RespondSol. Solutions are sorted by objective in the pool, so
+   * the harvest stops at the first non-improving solution.
+   */
+  const int solCount = model->get(GRB_IntAttr_SolCount);
+  const unsigned int Nx = this->countries_LCP.at(player)->getNcol();
+  for (int k = 1; k < solCount; ++k) {
+    model->set(GRB_IntParam_SolutionNumber, k);
+    if (model->get(GRB_DoubleAttr_PoolObjVal) >= threshold)
+      break;
+    arma::vec sol(Nx, arma::fill::zeros);
+    for (unsigned int i = 0; i < Nx; ++i)
+      sol.at(i) =
+          model->getVarByName("x_" + to_string(i)).get(GRB_DoubleAttr_Xn);
+    pool.push_back(sol);
+  }
+  BOOST_LOG_TRIVIAL(debug)
+      << "Game::EPEC::harvestDevnPool: harvested " << pool.size()
+      << " additional deviations for player " << player;
+}
+
+double Game::EPEC::RespondKnownPoly(
+    arma::vec &sol,      ///< [out] Profitable response, if any
+    unsigned int player, ///< Player whose response is to be computed
+    const arma::vec &x, ///< A vector of pure strategies (either for all players
+                        ///< or all other players
+    const double threshold, ///< A response is profitable only if its objective
+                            ///< is strictly smaller than this value
+    long int &poly ///< [out] Decimal encoding of the polyhedron containing the
+                   ///< profitable response. -1 if none is found.
+) const {
+  /**
+   * @brief Cheap first phase of the best response computation.
+   * @details Instead of solving the MPEC of player @p player as an MIQP, solves
+   * the leader's problem over each of the polyhedra that are known to be
+   * feasible but are not yet part of the inner approximation (see
+   * Game::LCP::getFeasiblePolyCandidates). Each of these is an LP or a convex
+   * QP. The first response whose objective is smaller than @p threshold is
+   * returned in @p sol, and the polyhedron containing it in @p poly.
+   * @returns The objective value of the profitable response, or GRB_INFINITY if
+   * none of the candidate polyhedra yields one.
+   */
+  poly = -1;
+  arma::vec solOther;
+  this->get_x_minus_i(x, player, solOther);
+  const auto &LCP_i = this->countries_LCP.at(player);
+  const auto candidates = LCP_i->getFeasiblePolyCandidates();
+  BOOST_LOG_TRIVIAL(trace) << "Game::EPEC::RespondKnownPoly: "
+                           << candidates.size()
+                           << " candidate polyhedra for player " << player;
+  for (const auto &candidate : candidates) {
+    auto model = LCP_i->MPECasQP(candidate, this->LeadObjec.at(player)->Q,
+                                 this->LeadObjec.at(player)->C,
+                                 this->LeadObjec.at(player)->c, solOther, true);
+    if (model->get(GRB_IntAttr_Status) != GRB_OPTIMAL)
+      continue;
+    const double val = model->get(GRB_DoubleAttr_ObjVal);
+    if (val < threshold) {
+      const unsigned int Nx = LCP_i->getNcol();
+      sol.zeros(Nx);
+      for (unsigned int i = 0; i < Nx; ++i)
+        sol.at(i) =
+            model->getVarByName("x_" + to_string(i)).get(GRB_DoubleAttr_X);
+      poly = static_cast<long int>(candidate);
+      BOOST_LOG_TRIVIAL(debug)
+          << "Game::EPEC::RespondKnownPoly: profitable deviation for player "
+          << player << " in known polyhedron " << candidate;
+      return val;
+    }
+  }
+  return GRB_INFINITY;
+}
+
 bool Game::EPEC::isSolved(unsigned int *countryNumber, arma::vec *ProfDevn,
                           double tol) const
 /**
@@ -1477,6 +1834,16 @@ bool Game::EPEC::isSolved(unsigned int *countryNumber, arma::vec *ProfDevn,
   this->nashgame->isSolved(this->sol_x, *countryNumber, *ProfDevn);
   arma::vec objvals = this->nashgame->ComputeQPObjvals(this->sol_x, true);
   for (unsigned int i = 0; i < this->nCountr; ++i) {
+    if (this->Stats.AlgorithmParam.twoPhaseResponse) {
+      // A profitable deviation in a known polyhedron is enough to reject
+      long int poly{-1};
+      this->RespondKnownPoly(*ProfDevn, i, this->sol_x, objvals.at(i) - tol,
+                             poly);
+      if (poly >= 0) {
+        *countryNumber = i;
+        return false;
+      }
+    }
     double val = this->RespondSol(*ProfDevn, i, this->sol_x);
     if (val == GRB_INFINITY)
       return false;
@@ -1509,6 +1876,11 @@ void Game::EPEC::make_country_QP(const unsigned int i)
  * object in @p Game::EPEC::LeadObjec
  *  - Finally the locations are updated owing to the complete convex hull
  * calculated during the call to LCP::makeQP
+ *  - The result is memoized, keyed by the polyhedra of the country in the
+ * order of LCP::getPolyOrder, which fixes the layout of the convex hull
+ * variables, if Game::EPECAlgorithmParams::hullCacheSize is positive. Up to
+ * that many hulls are kept per country, whatever their size, and the least
+ * recently used one is evicted first.
  * @note Overloaded as Models::EPEC::make_country_QP()
  */
 {
@@ -1520,9 +1892,33 @@ void Game::EPEC::make_country_QP(const unsigned int i)
   if (i >= this->nCountr)
     throw string(
         "Error in Game::EPEC::make_country_QP: Invalid country number");
+  const auto &polyhedra = this->countries_LCP.at(i)->getPolyOrder();
+  const unsigned int cacheSize = this->Stats.AlgorithmParam.hullCacheSize;
+  // Polyhedra not added through LCP::FixToPoly are not tracked in the order
+  const bool cacheable =
+      cacheSize > 0 && !polyhedra.empty() &&
+      polyhedra.size() == this->countries_LCP.at(i)->conv_Npoly();
+  auto &cache = this->hullCache.at(i);
+  if (cacheable) {
+    for (auto it = cache.begin(); it != cache.end(); ++it) {
+      if (it->polyhedra != polyhedra)
+        continue;
+      cache.splice(cache.begin(), cache, it);
+      // Copies, since the QPs are later changed by Game::QP_Param::addDummy
+      this->country_QP.at(i) =
+          std::make_shared<Game::QP_Param>(*cache.front().QP);
+      this->LeadObjec_ConvexHull.at(i) =
+          std::make_shared<Game::QP_objective>(*cache.front().objective);
+      this->Stats.feasiblePolyhedra.at(i) = cache.front().feasiblePolyhedra;
+      ++this->Stats.hullCacheHits.at(i);
+      return;
+    }
+  }
   // if (!this->country_QP.at(i).get())
   {
-    this->country_QP.at(i) = std::make_shared<Game::QP_Param>(this->env);
+    this->country_QP.at(i) =
+        std::make_shared<Game::QP_Param>(this->getCountryEnv(i));
+    this->country_QP.at(i)->deadline = &this->deadline;
     const auto &origLeadObjec = *this->LeadObjec.at(i).get();
 
     this->LeadObjec_ConvexHull.at(i).reset(new Game::QP_objective{
@@ -1533,6 +1929,16 @@ void Game::EPEC::make_country_QP(const unsigned int i)
     this->Stats.feasiblePolyhedra.at(i) =
         this->countries_LCP.at(i)->getFeasiblePolyhedra();
   }
+  if (cacheable) {
+    ++this->Stats.hullCacheMisses.at(i);
+    cache.push_front(HullCacheEntry{
+        polyhedra, std::make_shared<Game::QP_Param>(*this->country_QP.at(i)),
+        std::make_shared<Game::QP_objective>(
+            *this->LeadObjec_ConvexHull.at(i)),
+        this->Stats.feasiblePolyhedra.at(i)});
+    while (cache.size() > cacheSize)
+      cache.pop_back();
+  }
 }
 
 void Game::EPEC::make_country_QP()
@@ -1547,6 +1953,19 @@ void Game::EPEC::make_country_QP()
   for (unsigned int i = 0; i < this->nCountr; ++i) {
     this->Game::EPEC::make_country_QP(i);
   }
+  this->updateConvexHullLocs();
+}
+
+void Game::EPEC::updateConvexHullLocs()
+/**
+ * @brief Accounts for the convex hull variables of each country
+ * @details Once Game::EPEC::make_country_QP(const unsigned int i) has been
+ * called for every country, adds the dummy parameters for the new convex hull
+ * variables to all other players' QPs, and updates the locations accordingly.
+ * The countries are processed in order, so that the result does not depend on
+ * the order in which the hulls were made.
+ */
+{
   for (unsigned int i = 0; i < this->nCountr; ++i) {
     // LeadLocs &Loc = this->Locations.at(i);
     // Adjusting "stuff" because we now have new convHull variables
@@ -1555,7 +1974,7 @@ void Game::EPEC::make_country_QP()
         this->LeadObjec_ConvexHull.at(i)->Q.n_rows - originalSizeWithoutHull;
 
     BOOST_LOG_TRIVIAL(trace)
-        << "Game::EPEC::make_country_QP: Added " << convHullVarCount
+        << "Game::EPEC::updateConvexHullLocs: Added " << convHullVarCount
         << " convex hull variables to QP #" << i;
 
     // Location details
@@ -1579,14 +1998,15 @@ void Game::EPEC::make_country_QP()
       cerr << e << '\n';
       throw;
     } catch (string e) {
-      cerr << "String in Game::EPEC::make_country_QP : " << e << '\n';
+      cerr << "String in Game::EPEC::updateConvexHullLocs : " << e << '\n';
       throw;
     } catch (GRBException &e) {
-      cerr << "GRBException in Game::EPEC::make_country_QP : "
+      cerr << "GRBException in Game::EPEC::updateConvexHullLocs : "
            << e.getErrorCode() << ": " << e.getMessage() << '\n';
       throw;
     } catch (exception &e) {
-      cerr << "Exception in Game::EPEC::make_country_QP : " << e.what() << '\n';
+      cerr << "Exception in Game::EPEC::updateConvexHullLocs : " << e.what()
+           << '\n';
       throw;
     }
   }
@@ -1599,7 +2019,20 @@ bool Game::EPEC::getAllDevns(
         &devns, ///< [out] The vector of deviations for all players
     const arma::vec &guessSol, ///< [in] The guess for the solution vector
     const std::vector<arma::vec>
-        &prevDev //<[in] The previous vecrtor of deviations, if any exist.
+        &prevDev, //<[in] The previous vecrtor of deviations, if any exist.
+    std::vector<long int>
+        *devnPoly, //<[out] If not null, the decimal encoding of the known
+                   // polyhedron containing each deviation (-1 if unknown)
+    std::vector<std::vector<arma::vec>>
+        *devnPool, //<[out] If not null, additional improving deviations for
+                   // each player, harvested from the best response pool
+    std::vector<double> *regrets, //<[out] If not null, the regret of each
+                                  // player at guessSol (GRB_INFINITY if
+                                  // unknown)
+    const std::vector<arma::vec>
+        &knownDevns //<[in] If non-empty, the non-empty entries are used as
+                    // the deviation of that player without solving its best
+                    // response (see Game::EPEC::certifyRegret)
 ) const
 /**
  * @brief Given a potential solution vector, returns a profitable deviation (if
@@ -1607,29 +2040,110 @@ bool Game::EPEC::getAllDevns(
  * @return a vector of computed deviations, which empty if at least one
  * deviation cannot be computed
  * @param prevDev can be empty
+ * @details If Game::EPECAlgorithmParams::twoPhaseResponse is true, any
+ * profitable deviation suffices, and Game::EPEC::RespondKnownPoly is tried
+ * before solving the full MPEC with Game::EPEC::RespondSol.
+ * If @p devnPool is not null, the improving solutions of the best response
+ * pool are returned as well (see Game::EPECAlgorithmParams::devnPoolSize).
  */
 {
   devns = std::vector<arma::vec>(this->nCountr);
+  if (devnPoly)
+    *devnPoly = std::vector<long int>(this->nCountr, -1);
+  if (devnPool)
+    *devnPool = std::vector<std::vector<arma::vec>>(this->nCountr);
+  if (regrets)
+    *regrets = std::vector<double>(this->nCountr, GRB_INFINITY);
+  const bool knownObj = this->nashgame && this->nashEq;
+  arma::vec objvals;
+  if (knownObj)
+    objvals = this->nashgame->ComputeQPObjvals(guessSol, false);
 
   for (unsigned int i = 0; i < this->nCountr; ++i) { // For each country
-    // If we cannot compute a deviation, it means model is infeasible!
-    double objVal{0};
-    objVal = this->RespondSol(devns.at(i), i, guessSol, prevDev.at(i));
-    if (objVal == GRB_INFINITY)
+    if (!this->getCountryDevn(devns.at(i), i, guessSol, objvals, prevDev.at(i),
+                              devnPoly ? &devnPoly->at(i) : nullptr,
+                              devnPool ? &devnPool->at(i) : nullptr,
+                              regrets ? &regrets->at(i) : nullptr,
+                              knownDevns.empty() ? arma::vec{}
+                                                 : knownDevns.at(i)))
       return false;
     // cout << "Game::EPEC::getAllDevns: devns(i): " <<devns.at(i);
   }
   return true;
 }
 
+bool Game::EPEC::getCountryDevn(
+    arma::vec &devn,           ///< [out] The deviation of the player
+    const unsigned int i,      ///< [in] The player
+    const arma::vec &guessSol, ///< [in] The guess for the solution vector
+    const arma::vec &objvals, ///< [in] The objective of each player at @p
+                              ///< guessSol. Empty if there is no current
+                              ///< profile
+    const arma::vec &prevDev, ///< [in] The previous deviation, if any
+    long int *poly, ///< [out] If not null, the decimal encoding of the known
+                    ///< polyhedron containing the deviation (-1 if unknown)
+    std::vector<arma::vec> *pool, ///< [out] If not null, additional
+                                  ///< improving deviations from the best
+                                  ///< response pool
+    double *regret, ///< [out] If not null, an upper bound on the regret of
+                    ///< the player at @p guessSol. GRB_INFINITY if unknown
+    const arma::vec &knownDevn ///< [in] If non-empty, a profitable deviation
+                               ///< already computed, returned as it is
+) const
+/**
+ * @brief Computes the deviation of the @p i-th player only. See
+ * Game::EPEC::getAllDevns.
+ * @details Only reads the data of the @p i-th country, hence it can run
+ * concurrently for different players (see Game::EPEC::pipelinedDevns).
+ * @returns false if no deviation can be computed
+ */
+{
+  const bool knownObj = !objvals.empty();
+  if (poly)
+    *poly = -1;
+  if (regret)
+    *regret = GRB_INFINITY;
+  if (!knownDevn.empty()) {
+    devn = knownDevn;
+    return true;
+  }
+  if (this->Stats.AlgorithmParam.twoPhaseResponse && knownObj) {
+    long int knownPoly{-1};
+    this->RespondKnownPoly(devn, i, guessSol,
+                           objvals.at(i) - this->currentSolvedTol(), knownPoly);
+    if (knownPoly >= 0) {
+      if (poly)
+        *poly = knownPoly;
+      return true;
+    }
+  }
+  // If we cannot compute a deviation, it means model is infeasible!
+  // Without a current profile, any feasible point of the pool is useful
+  const double poolThreshold =
+      knownObj ? objvals.at(i) - this->currentSolvedTol() : GRB_INFINITY;
+  double bound{-GRB_INFINITY};
+  const double objVal = this->RespondSol(devn, i, guessSol, prevDev, pool,
+                                         poolThreshold, &bound);
+  if (regret && knownObj && bound > -GRB_INFINITY)
+    *regret = std::max(0.0, objvals.at(i) - bound);
+  return objVal != GRB_INFINITY;
+}
+
 unsigned int Game::EPEC::addDeviatedPolyhedron(
     const std::vector<arma::vec>
         &devns,       ///< devns.at(i) is a profitable deviation
                       ///< for the i-th country from the current this->sol_x
-    bool &infeasCheck ///< Useful for the first iteration of iterativeNash. If
-                      ///< true, at least one player has no polyhedron that can
-                      ///< be added. In the first iteration, this translates to
-                      ///< infeasability
+    bool &infeasCheck, ///< Useful for the first iteration of iterativeNash.
+                       ///< If true, at least one player has no polyhedron that
+                       ///< can be added. In the first iteration, this
+                       ///< translates to infeasability
+    const std::vector<long int>
+        &devnPoly, ///< If non-empty and devnPoly.at(i) is non-negative, the
+                   ///< decimal encoding of the polyhedron containing
+                   ///< devns.at(i)
+    const std::vector<std::vector<arma::vec>>
+        &devnPool ///< If non-empty, additional profitable deviations for each
+                  ///< country, whose polyhedra are added in the same pass
 ) const {
   /**
    * Given a profitable deviation for each country, adds <i>a</i> polyhedron in
@@ -1639,27 +2153,256 @@ unsigned int Game::EPEC::addDeviatedPolyhedron(
    *
    * Naturally, this makes the inner approximation of the Game::LCP better, by
    * including one additional polyhedron.
+   *
+   * If @p devnPool is given, the polyhedra containing the additional
+   * deviations are added too. Game::LCP::addPolyFromX skips the ones already
+   * in the inner approximation, so that only distinct polyhedra are added.
+   * @returns The number of polyhedra added.
    */
 
   infeasCheck = false;
   unsigned int added = 0;
   for (unsigned int i = 0; i < this->nCountr; ++i) { // For each country
-    bool ret = false;
-    if (!devns.at(i).empty())
-      this->countries_LCP.at(i)->addPolyFromX(devns.at(i), ret);
-    if (ret) {
-      BOOST_LOG_TRIVIAL(debug)
-          << "Game::EPEC::addDeviatedPolyhedron: added polyhedron for player "
-          << i << " " << added;
-      ++added;
-    } else {
+    if (!this->addDeviatedPolyhedron(
+            i, devns.at(i), devnPoly.empty() ? -1 : devnPoly.at(i),
+            devnPool.empty() ? std::vector<arma::vec>{} : devnPool.at(i),
+            added))
       infeasCheck = true;
-      BOOST_LOG_TRIVIAL(trace) << "Game::EPEC::addDeviatedPolyhedron: NO "
-                                  "polyhedron added for player "
+  }
+  return added;
+}
+
+bool Game::EPEC::addDeviatedPolyhedron(
+    const unsigned int i, ///< The country
+    const arma::vec &devn, ///< A profitable deviation for the country
+    const long int poly, ///< If non-negative, the decimal encoding of the
+                         ///< polyhedron containing @p devn
+    const std::vector<arma::vec>
+        &pool,            ///< Additional profitable deviations
+    unsigned int &added ///< [in/out] Incremented by the number of polyhedra
+                        ///< added
+) const {
+  /**
+   * Adds the polyhedra containing the deviations of the @p i-th country only.
+   * See Game::EPEC::addDeviatedPolyhedron(const std::vector<arma::vec>&,
+   * bool&, const std::vector<long int>&, const
+   * std::vector<std::vector<arma::vec>>&) const
+   * @returns false if no polyhedron was added
+   */
+  bool ret = false;
+  if (poly >= 0)
+    ret = this->countries_LCP.at(i)->addThePoly(poly);
+  else if (!devn.empty())
+    this->countries_LCP.at(i)->addPolyFromX(devn, ret);
+  if (ret) {
+    BOOST_LOG_TRIVIAL(debug)
+        << "Game::EPEC::addDeviatedPolyhedron: added polyhedron for player "
+        << i << " " << added;
+    ++added;
+  }
+  for (const auto &poolDevn : pool) {
+    bool retPool = false;
+    this->countries_LCP.at(i)->addPolyFromX(poolDevn, retPool);
+    if (retPool) {
+      BOOST_LOG_TRIVIAL(debug) << "Game::EPEC::addDeviatedPolyhedron: "
+                                  "added pool polyhedron for player "
                                << i;
+      ++added;
+      ret = true;
     }
   }
-  return added;
+  if (!ret)
+    BOOST_LOG_TRIVIAL(trace) << "Game::EPEC::addDeviatedPolyhedron: NO "
+                                "polyhedron added for player "
+                             << i;
+  return ret;
+}
+
+GRBEnv *Game::EPEC::getCountryEnv(const unsigned int i) const {
+  /// Returns the Gurobi environment of the @p i-th country, that is
+  /// Game::EPEC::env unless Game::EPECAlgorithmParams::pipelined was set
+  /// before Game::EPEC::finalize
+  if (this->countryEnvs.size() == this->nCountr)
+    return this->countryEnvs.at(i).get();
+  return this->env;
+}
+
+std::vector<std::vector<unsigned long int>>
+Game::EPEC::getSupportPolys() const {
+  /**
+   * @brief The decimal encoding of the polyhedra played with positive
+   * probability by each country in Game::EPEC::sol_x
+   * @details As Game::EPEC::getSupport, with the indices mapped through
+   * Game::LCP::getPolyOrder. Countries whose polyhedra are not all tracked
+   * there get an empty support.
+   */
+  const auto indices = this->getSupport(this->sol_x);
+  std::vector<std::vector<unsigned long int>> support(this->nCountr);
+  for (unsigned int i = 0; i < this->nCountr; ++i) {
+    const auto &order = this->countries_LCP.at(i)->getPolyOrder();
+    if (order.size() != this->getNPoly_Lead(i))
+      continue;
+    for (const auto j : indices.at(i))
+      support.at(i).push_back(order.at(j));
+  }
+  return support;
+}
+
+unsigned int Game::EPEC::expandNeighbourPolys(
+    const std::vector<arma::vec>
+        &devns, ///< The profitable deviation of each country, possibly empty
+    const std::vector<std::vector<unsigned long int>>
+        &support ///< The support of each country, see getSupportPolys
+) {
+  /**
+   * @brief Enlarges the inner approximation of each country around its
+   * support and its deviation
+   * @details The candidates are given by Game::LCP::getNeighbourPolys, with
+   * the polyhedra containing the degenerate deviation first. They are checked
+   * for feasibility in batches, in parallel (see Game::LCP::checkPolyFeas),
+   * until Game::EPECAlgorithmParams::neighbourExpansion polyhedra have been
+   * added to the country. The environments of the workers are made on the
+   * first call, and kept in Game::EPEC::polyFeasEnvs.
+   * @returns The number of polyhedra added
+   */
+  const unsigned int cap = this->Stats.AlgorithmParam.neighbourExpansion;
+  const unsigned int threads =
+      this->Stats.AlgorithmParam.threads > 0
+          ? this->Stats.AlgorithmParam.threads
+          : std::max(1u, std::thread::hardware_concurrency());
+  while (this->polyFeasEnvs.size() < threads) {
+    this->polyFeasEnvs.push_back(std::unique_ptr<GRBEnv>(new GRBEnv()));
+    this->polyFeasEnvs.back()->set(GRB_IntParam_Threads, 1);
+    this->polyFeasEnvs.back()->set(GRB_IntParam_OutputFlag, 0);
+  }
+  std::vector<GRBEnv *> envs{};
+  for (unsigned int w = 0; w < threads; ++w)
+    envs.push_back(this->polyFeasEnvs.at(w).get());
+  unsigned int total{0};
+  for (unsigned int i = 0; i < this->nCountr; ++i) {
+    auto &LCP_i = this->countries_LCP.at(i);
+    const auto candidates =
+        LCP_i->getNeighbourPolys(devns.at(i), support.at(i));
+    unsigned int added{0};
+    for (unsigned int k = 0; k < candidates.size() && added < cap;) {
+      const unsigned int batch = std::max(cap - added, threads);
+      const std::vector<unsigned long int> chunk(
+          candidates.begin() + k,
+          candidates.begin() +
+              std::min<unsigned int>(k + batch, candidates.size()));
+      k += chunk.size();
+      for (const auto poly : LCP_i->checkPolyFeas(chunk, envs)) {
+        if (added < cap && LCP_i->addThePoly(poly))
+          ++added;
+      }
+    }
+    BOOST_LOG_TRIVIAL(debug)
+        << "Game::EPEC::expandNeighbourPolys: added " << added << " of "
+        << candidates.size() << " neighbouring polyhedra for player " << i;
+    total += added;
+  }
+  return total;
+}
+
+unsigned int Game::EPEC::pipelinedDevns(
+    std::vector<arma::vec> &devns, ///< [out] The deviation of each country
+    const std::vector<arma::vec>
+        &prevDevns,   ///< [in] The previous deviations, if any
+    bool &infeasCheck, ///< [out] True if no polyhedron was added for at
+                       ///< least one country
+    std::vector<double> *regrets, ///< [out] If not null, the regret of each
+                                  ///< country at Game::EPEC::sol_x
+    const std::vector<arma::vec>
+        &knownDevns ///< [in] Deviations at Game::EPEC::sol_x already
+                    ///< computed, if any (see Game::EPEC::getAllDevns)
+) {
+  /**
+   * @brief Pipelined version of Game::EPEC::getAllDevns,
+   * Game::EPEC::addDeviatedPolyhedron and Game::EPEC::make_country_QP
+   * @details Each country runs as a separate task: its best responses (from
+   * Game::EPEC::sol_x and any solution in Game::EPEC::masterPoolSols), the
+   * addition of the deviated polyhedra and its convex hull. A country's hull is
+   * therefore made while the other countries' best responses are still
+   * running. Each task only touches its own country's data and Gurobi
+   * environment (see Game::EPEC::getCountryEnv), and the results are merged in
+   * country order by Game::EPEC::updateConvexHullLocs, so that the outcome
+   * does not depend on the scheduling. The time spent on the hulls, summed
+   * over the countries, is stored in Game::EPEC::lastHullTime.
+   * @returns The number of polyhedra added.
+   */
+  devns = std::vector<arma::vec>(this->nCountr);
+  if (regrets)
+    *regrets = std::vector<double>(this->nCountr, GRB_INFINITY);
+  // Everything depending on the current master is computed before any hull
+  // changes
+  const bool knownObj = this->nashgame && this->nashEq;
+  std::vector<arma::vec> guesses{this->sol_x};
+  guesses.insert(guesses.end(), this->masterPoolSols.begin(),
+                 this->masterPoolSols.end());
+  std::vector<arma::vec> objvals(guesses.size());
+  if (knownObj)
+    for (unsigned int k = 0; k < guesses.size(); ++k)
+      objvals.at(k) = this->nashgame->ComputeQPObjvals(guesses.at(k), false);
+
+  std::vector<unsigned int> added(this->nCountr, 0);
+  std::vector<char> addedAny(this->nCountr, 0);
+  std::vector<double> hullTimes(this->nCountr, 0);
+  auto countryTask = [&](const unsigned int i) {
+    std::vector<arma::vec> countryDevns(guesses.size());
+    std::vector<long int> polys(guesses.size(), -1);
+    std::vector<arma::vec> pool{};
+    for (unsigned int k = 0; k < guesses.size(); ++k) {
+      if (!this->getCountryDevn(countryDevns.at(k), i, guesses.at(k),
+                                objvals.at(k), prevDevns.at(i), &polys.at(k),
+                                k == 0 ? &pool : nullptr,
+                                k == 0 && regrets ? &regrets->at(i)
+                                                  : nullptr,
+                                k == 0 && !knownDevns.empty()
+                                    ? knownDevns.at(i)
+                                    : arma::vec{}))
+        countryDevns.at(k).reset();
+    }
+    devns.at(i) = countryDevns.at(0);
+    this->Stats.knownPolyDevns.at(i) +=
+        std::count_if(polys.begin(), polys.end(),
+                      [](const long int poly) { return poly >= 0; });
+    this->Stats.pooledDevns.at(i) += pool.size();
+    for (unsigned int k = 0; k < guesses.size(); ++k) {
+      if (this->addDeviatedPolyhedron(i, countryDevns.at(k), polys.at(k),
+                                      k == 0 ? pool : std::vector<arma::vec>{},
+                                      added.at(i)))
+        addedAny.at(i) = 1;
+    }
+    const auto hullStart = std::chrono::high_resolution_clock::now();
+    this->make_country_QP(i);
+    const std::chrono::duration<double> hullTime =
+        std::chrono::high_resolution_clock::now() - hullStart;
+    hullTimes.at(i) = hullTime.count();
+  };
+
+  std::vector<std::future<void>> tasks;
+  for (unsigned int i = 0; i < this->nCountr; ++i)
+    tasks.push_back(std::async(std::launch::async, countryTask, i));
+  try {
+    for (auto &task : tasks)
+      task.get();
+  } catch (string &e) {
+    cerr << "String in Game::EPEC::pipelinedDevns : " << e << '\n';
+    throw;
+  } catch (GRBException &e) {
+    cerr << "GRBException in Game::EPEC::pipelinedDevns : " << e.getErrorCode()
+         << ": " << e.getMessage() << '\n';
+    throw;
+  } catch (exception &e) {
+    cerr << "Exception in Game::EPEC::pipelinedDevns : " << e.what() << '\n';
+    throw;
+  }
+
+  infeasCheck =
+      std::find(addedAny.begin(), addedAny.end(), 0) != addedAny.end();
+  this->lastHullTime = std::accumulate(hullTimes.begin(), hullTimes.end(), 0.0);
+  this->updateConvexHullLocs();
+  return std::accumulate(added.begin(), added.end(), 0u);
 }
 
 bool Game::EPEC::addRandomPoly2All(unsigned int aggressiveLevel,
@@ -1681,10 +2424,21 @@ bool Game::EPEC::addRandomPoly2All(unsigned int aggressiveLevel,
  */
 {
   BOOST_LOG_TRIVIAL(trace) << "Adding random polyhedra to countries";
+  const bool adaptive = this->Stats.AlgorithmParam.adaptiveAggressiveness;
+  if (adaptive)
+    this->updateAggressiveness();
   bool infeasible{true};
   for (unsigned int i = 0; i < this->nCountr; i++) {
+    if (this->Stats.AlgorithmParam.addPolyMethod ==
+        Game::EPECAddPolyMethod::guided) {
+      // The last equilibrium of the master, if any (see saveMasterStart)
+      const bool known = this->startLeadFoll.size() == this->nCountr;
+      this->countries_LCP.at(i)->setGuidePoint(
+          known ? this->startLeadFoll.at(i) : arma::vec{});
+    }
     auto addedPolySet = this->countries_LCP.at(i)->addAPoly(
-        aggressiveLevel, this->Stats.AlgorithmParam.addPolyMethod);
+        adaptive ? this->countryAggressiveness.at(i) : aggressiveLevel,
+        this->Stats.AlgorithmParam.addPolyMethod);
     if (stopOnSingleInfeasibility && addedPolySet.empty()) {
       BOOST_LOG_TRIVIAL(info)
           << "Game::EPEC::addRandomPoly2All: No Nash equilibrium. due to "
@@ -1698,6 +2452,57 @@ bool Game::EPEC::addRandomPoly2All(unsigned int aggressiveLevel,
   return !infeasible;
 }
 
+void Game::EPEC::updateAggressiveness()
+/**
+ * @brief Tunes the number of random polyhedra added to each country
+ * @details Used when Game::EPECAlgorithmParams::adaptiveAggressiveness is
+ * true. A common level starts at Game::EPECAlgorithmParams::aggressiveness,
+ * and is
+ *  - doubled when the last master LCP took less time than the last convex
+ * hulls, since a larger master is then affordable, and halved when it took
+ * more than four times as much;
+ *  - increased by one when more than half of the iterations so far lost the
+ * equilibrium (Game::EPECStatistics::lostIntermediateEq).
+ *
+ * The common level is kept in Game::EPEC::commonAggressiveness, so that it
+ * only changes through these rules. Each country then gets it scaled by 0.5
+ * plus its fraction of polyhedra neither added nor known to be infeasible,
+ * capped by their number.
+ * The values are appended to Game::EPECStatistics::aggressivenessLog.
+ */
+{
+  const unsigned int base =
+      std::max(1u, this->Stats.AlgorithmParam.aggressiveness);
+  const unsigned int maxLevel = std::max(8u, 4 * base);
+  unsigned int level =
+      this->commonAggressiveness > 0 ? this->commonAggressiveness : base;
+  if (this->lastMasterTime >= 0 && this->lastHullTime >= 0) {
+    if (this->lastMasterTime < this->lastHullTime)
+      level *= 2;
+    else if (this->lastMasterTime > 4 * this->lastHullTime)
+      level /= 2;
+  }
+  if (this->Stats.numIteration > 0 &&
+      2 * this->Stats.lostIntermediateEq > this->Stats.numIteration)
+    ++level;
+  level = std::min(std::max(level, 1u), maxLevel);
+  this->commonAggressiveness = level;
+
+  this->countryAggressiveness = std::vector<unsigned int>(this->nCountr, 1);
+  for (unsigned int i = 0; i < this->nCountr; ++i) {
+    const auto &LCP_i = this->countries_LCP.at(i);
+    const double total = LCP_i->getNumTheoreticalPoly();
+    const double explored = LCP_i->conv_Npoly() + LCP_i->getNumKnownInfeas();
+    const double remaining = std::max(total - explored, 0.0);
+    const double scaled = std::round(level * (0.5 + remaining / total));
+    this->countryAggressiveness.at(i) = static_cast<unsigned int>(
+        std::max(1.0, std::min(scaled, std::max(remaining, 1.0))));
+  }
+  this->Stats.aggressivenessLog.push_back(this->countryAggressiveness);
+  BOOST_LOG_TRIVIAL(debug) << "Game::EPEC::updateAggressiveness: level "
+                           << level;
+}
+
 void Game::EPEC::iterativeNash() {
 
   // Set the initial point for all countries as 0 and solve the respective LCPs?
@@ -1715,6 +2520,12 @@ void Game::EPEC::iterativeNash() {
 
   std::vector<arma::vec> prevDevns(this->nCountr);
   this->Stats.numIteration = 0;
+  this->countryAggressiveness.clear();
+  this->commonAggressiveness = 0;
+  this->continuationFactor =
+      std::max(1.0, this->Stats.AlgorithmParam.continuationStart);
+  this->lastMasterTime = -1;
+  this->lastHullTime = -1;
   if (this->Stats.AlgorithmParam.addPolyMethod == EPECAddPolyMethod::random) {
     for (unsigned int i = 0; i < this->nCountr; ++i) {
       long int seed = this->Stats.AlgorithmParam.addPolyMethodSeed < 0
@@ -1726,12 +2537,22 @@ void Game::EPEC::iterativeNash() {
       this->countries_LCP.at(i)->addPolyMethodSeed = seed;
     }
   }
-  if (this->Stats.AlgorithmParam.timeLimit > 0)
-    this->initTime = std::chrono::high_resolution_clock::now();
-
   // Stay in this loop, till you find a Nash equilibrium or prove that there
   // does not exist a Nash equilibrium or you run out of time.
+  const bool pipelined{this->Stats.AlgorithmParam.pipelined &&
+                       this->countryEnvs.size() == this->nCountr};
+  if (this->Stats.AlgorithmParam.pipelined && !pipelined)
+    BOOST_LOG_TRIVIAL(warning)
+        << "Game::EPEC::iterativeNash: pipelined was set after finalize. "
+           "Running sequentially.";
   while (!solved) {
+    if (Game::EPEC::stopRequested() || this->deadline.expired()) {
+      BOOST_LOG_TRIVIAL(warning)
+          << "Game::EPEC::iterativeNash: stop requested or out of time.";
+      this->Stats.status = Game::EPECsolveStatus::timeLimit;
+      return;
+    }
+    bool hullsMade{false};
     ++this->Stats.numIteration;
     BOOST_LOG_TRIVIAL(info) << "Game::EPEC::iterativeNash: Iteration "
                             << to_string(this->Stats.numIteration);
@@ -1743,15 +2564,48 @@ void Game::EPEC::iterativeNash() {
           this->addRandomPoly2All(this->Stats.AlgorithmParam.aggressiveness,
                                   this->Stats.numIteration == 1);
       if (!success) {
-        this->Stats.status = Game::EPECsolveStatus::nashEqNotFound;
+        // Polyhedra left unchecked by the deadline prove nothing
+        this->Stats.status = this->deadline.expired()
+                                 ? Game::EPECsolveStatus::timeLimit
+                                 : Game::EPECsolveStatus::nashEqNotFound;
         solved = true;
         return;
       }
     } else { // else we are in the case of finding deviations.
+      // Responses that already disprove the epsilon-equilibrium
+      std::vector<arma::vec> certifiedDevns{};
+      if (this->Stats.AlgorithmParam.epsilon > 0 && this->nashEq) {
+        const double regret = this->certifyRegret(&certifiedDevns);
+        if (regret <= this->Stats.AlgorithmParam.epsilon &&
+            (!this->Stats.AlgorithmParam.pureNE || this->isPureStrategy())) {
+          BOOST_LOG_TRIVIAL(info)
+              << "Game::EPEC::iterativeNash: epsilon-Nash equilibrium with "
+                 "regret at most "
+              << regret;
+          this->Stats.status = Game::EPECsolveStatus::nashEqFound;
+          this->Stats.pureNE = this->isPureStrategy();
+          this->Stats.approximate = true;
+          solved = true;
+          return;
+        }
+      }
+      const bool violated =
+          std::any_of(certifiedDevns.begin(), certifiedDevns.end(),
+                      [](const arma::vec &d) { return !d.empty(); });
       unsigned int deviatedCountry{0};
       arma::vec countryDeviation{};
-      if (this->isSolved(&deviatedCountry, &countryDeviation,
-                         this->Stats.AlgorithmParam.solvedTol)) {
+      bool solvedNow =
+          !violated && this->isSolved(&deviatedCountry, &countryDeviation,
+                                      this->currentSolvedTol());
+      if (solvedNow && this->continuationFactor > 1) {
+        // Certify with the configured tolerances
+        BOOST_LOG_TRIVIAL(info) << "Game::EPEC::iterativeNash: ending the "
+                                   "tolerance continuation";
+        this->continuationFactor = 1;
+        solvedNow = this->isSolved(&deviatedCountry, &countryDeviation,
+                                   this->currentSolvedTol());
+      }
+      if (solvedNow) {
         this->Stats.status = Game::EPECsolveStatus::nashEqFound;
         this->Stats.pureNE = this->isPureStrategy();
         if ((this->Stats.AlgorithmParam.pureNE && !this->Stats.pureNE)) {
@@ -1781,6 +2635,22 @@ void Game::EPEC::iterativeNash() {
             }
             this->combinatorialPNE(start, excludeList);
             return;
+          } else if (this->Stats.AlgorithmParam.recoverStrategy ==
+                     Game::EPECRecoverStrategy::supportReduction) {
+            BOOST_LOG_TRIVIAL(info) << "Game::EPEC::iterativeNash: triggering "
+                                       "recover strategy (supportReduction)";
+            // The exclude list refers to the inner approximation, which the
+            // support reduction overwrites
+            std::vector<std::set<unsigned long int>> excludeList;
+            std::vector<long int> start;
+            for (unsigned int j = 0; j < this->nCountr; ++j) {
+              excludeList.push_back(
+                  this->countries_LCP.at(j)->getAllPolyhedra());
+              start.push_back(-1);
+            }
+            if (!this->supportReductionPNE())
+              this->combinatorialPNE(start, excludeList);
+            return;
           }
 
         } else {
@@ -1788,11 +2658,66 @@ void Game::EPEC::iterativeNash() {
           return;
         }
       }
+      // Read before any polyhedron is added, while sol_x matches the layout
+      const auto support = this->Stats.AlgorithmParam.neighbourExpansion > 0
+                               ? this->getSupportPolys()
+                               : std::vector<std::vector<unsigned long int>>{};
+      arma::vec masterMC{};
+      const auto masterLeadFoll = this->nashEq
+                                      ? this->getLeadFoll(this->sol_x, masterMC)
+                                      : std::vector<arma::vec>{};
       // Vector of deviations for the countries
       std::vector<arma::vec> devns = std::vector<arma::vec>(this->nCountr);
-      this->getAllDevns(devns, this->sol_x, prevDevns);
+      std::vector<double> regrets{};
+      unsigned int addedPoly{0};
+      if (pipelined) {
+        addedPoly = this->pipelinedDevns(devns, prevDevns, infeasCheck,
+                                         &regrets, certifiedDevns);
+        hullsMade = true;
+      } else {
+        std::vector<long int> devnPoly{};
+        std::vector<std::vector<arma::vec>> devnPool{};
+        this->getAllDevns(devns, this->sol_x, prevDevns, &devnPoly,
+                          &devnPool, &regrets, certifiedDevns);
+        // Deviations from the other solutions of the master LCP, computed
+        // before any polyhedron is added so they refer to the same layout
+        std::vector<std::vector<arma::vec>> poolDevns{};
+        std::vector<std::vector<long int>> poolDevnPoly{};
+        for (const auto &poolSol : this->masterPoolSols) {
+          poolDevns.push_back(std::vector<arma::vec>(this->nCountr));
+          poolDevnPoly.push_back({});
+          this->getAllDevns(poolDevns.back(), poolSol, prevDevns,
+                            &poolDevnPoly.back());
+        }
+        for (unsigned int i = 0; i < this->nCountr; ++i) {
+          this->Stats.knownPolyDevns.at(i) += devnPoly.at(i) >= 0;
+          this->Stats.pooledDevns.at(i) += devnPool.at(i).size();
+          for (const auto &polys : poolDevnPoly)
+            this->Stats.knownPolyDevns.at(i) += polys.at(i) >= 0;
+        }
+        addedPoly = this->addDeviatedPolyhedron(devns, infeasCheck, devnPoly,
+                                                devnPool);
+        for (unsigned int k = 0; k < poolDevns.size(); ++k) {
+          bool poolInfeas{false};
+          addedPoly += this->addDeviatedPolyhedron(
+              poolDevns.at(k), poolInfeas, poolDevnPoly.at(k));
+        }
+      }
+      if (!masterLeadFoll.empty())
+        this->updateIncumbent(masterLeadFoll, masterMC, regrets);
+      if (this->deadline.expired()) {
+        // The best responses may have been cut short
+        this->Stats.status = Game::EPECsolveStatus::timeLimit;
+        return;
+      }
+      if (!support.empty()) {
+        const unsigned int expanded =
+            this->expandNeighbourPolys(devns, support);
+        if (expanded > 0)
+          hullsMade = false;
+        addedPoly += expanded;
+      }
       prevDevns = devns;
-      unsigned int addedPoly = this->addDeviatedPolyhedron(devns, infeasCheck);
       if (addedPoly == 0 && this->Stats.numIteration > 1 &&
           !incrementalEnumeration) {
         BOOST_LOG_TRIVIAL(error)
@@ -1812,21 +2737,28 @@ void Game::EPEC::iterativeNash() {
         return;
       }
     }
-    this->make_country_QP();
+    auto stageStart = std::chrono::high_resolution_clock::now();
+    if (!hullsMade) {
+      this->make_country_QP();
+      const std::chrono::duration<double> hullTime =
+          std::chrono::high_resolution_clock::now() - stageStart;
+      this->lastHullTime = hullTime.count();
+    }
 
     // TimeLimit
-    if (this->Stats.AlgorithmParam.timeLimit > 0) {
-      const std::chrono::duration<double> timeElapsed =
-          std::chrono::high_resolution_clock::now() - this->initTime;
-      const double timeRemaining =
-          this->Stats.AlgorithmParam.timeLimit - timeElapsed.count();
-      addRandPoly = !this->computeNashEq(this->Stats.AlgorithmParam.pureNE,
-                                         timeRemaining) &&
-                    !incrementalEnumeration;
-    } else {
-      // No Time Limit
-      addRandPoly = !this->computeNashEq(this->Stats.AlgorithmParam.pureNE) &&
-                    !incrementalEnumeration;
+    stageStart = std::chrono::high_resolution_clock::now();
+    addRandPoly = !this->computeNashEq(this->Stats.AlgorithmParam.pureNE,
+                                       this->deadline.remaining()) &&
+                  !incrementalEnumeration;
+    const std::chrono::duration<double> masterTime =
+        std::chrono::high_resolution_clock::now() - stageStart;
+    this->lastMasterTime = masterTime.count();
+    if (!addRandPoly && this->continuationFactor > 1) {
+      // The inner approximation yields equilibria: tighten the tolerances
+      this->continuationFactor = std::max(1.0, this->continuationFactor / 10);
+      BOOST_LOG_TRIVIAL(debug)
+          << "Game::EPEC::iterativeNash: continuation factor "
+          << this->continuationFactor;
     }
     if (addRandPoly)
       this->Stats.lostIntermediateEq++;
@@ -1836,114 +2768,620 @@ void Game::EPEC::iterativeNash() {
     }
     // This might be reached when a NashEq is found, and need to be verified.
     // Anyway, we are over the timeLimit and we should stop
-    if (this->Stats.AlgorithmParam.timeLimit > 0) {
-      const std::chrono::duration<double> timeElapsed =
-          std::chrono::high_resolution_clock::now() - this->initTime;
-      const double timeRemaining =
-          this->Stats.AlgorithmParam.timeLimit - timeElapsed.count();
-      if (timeRemaining <= 0) {
-        solved = false;
-        if (!incrementalEnumeration)
-          this->Stats.status = Game::EPECsolveStatus::timeLimit;
-        return;
-      }
+    if (this->deadline.expired()) {
+      solved = false;
+      if (!incrementalEnumeration)
+        this->Stats.status = Game::EPECsolveStatus::timeLimit;
+      return;
     }
   }
 }
 
 void Game::EPEC::combinatorial_pure_NE(
-    const std::vector<long int> combination,
-    const std::vector<std::set<unsigned long int>> &excludeList) {
-
+    const std::vector<long int> combination, ///< Polyhedron of each country,
+                                             ///< -1 if it is free
+    const std::vector<std::set<unsigned long int>>
+        &excludeList, ///< Combinations made only of these polyhedra are skipped
+    const std::vector<std::vector<long int>>
+        &candidates ///< If not empty, the polyhedra tried for each free
+                    ///< country. Otherwise, all of them are tried
+) {
+  /**
+   * @brief Searches for a pure NE among the combinations of polyhedra
+   * extending @p combination
+   * @details
+   *  - The feasible polyhedra of each free country, and the Game::QP_Param of
+   * each of them, are computed once. With a single polyhedron per country
+   * there are no convex hull variables, hence all the combinations share the
+   * same layout. Polyhedra are sorted by Game::EPEC::orderCombinatorialPolys.
+   *  - Partial combinations are tasks. A task either expands into its children,
+   * by fixing the free country with the fewest polyhedra, or is a full
+   * combination to evaluate. Unless
+   * Game::EPECAlgorithmParams::combinatorialPruning is false, a partial
+   * combination is dropped if Game::EPEC::isPartialCombinationFeasible
+   * proves that it cannot lead to a pure NE.
+   *  - Tasks are run by Game::EPECAlgorithmParams::threads workers (all the
+   * processors, if 0). Each worker owns a deque, and steals from the others'
+   * when its own is empty. A worker finding no task sleeps until another one
+   * pushes tasks or the search is over. Each worker has its own Gurobi
+   * environment and its own copy of the countries' Game::LCP, for the best
+   * responses.
+   *  - All the workers stop as soon as one of them finds a pure NE (see
+   * Game::EPEC::isPureNECombination). Such a combination is then solved
+   * again here, so that the state of the object is the same as after any
+   * other algorithm.
+   */
   if ((this->Stats.status == EPECsolveStatus::nashEqFound &&
        this->Stats.pureNE == true) ||
       this->Stats.status == EPECsolveStatus::timeLimit)
     return;
 
-  if (this->Stats.AlgorithmParam.timeLimit > 0) {
-    const std::chrono::duration<double> timeElapsed =
-        std::chrono::high_resolution_clock::now() - this->initTime;
-    const double timeRemaining =
-        this->Stats.AlgorithmParam.timeLimit - timeElapsed.count();
-    if (timeRemaining <= 0) {
-      this->Stats.status = Game::EPECsolveStatus::timeLimit;
+  const auto timeRemaining = [this]() {
+    if (Game::EPEC::stopRequested())
+      return 0.0;
+    return this->deadline.remaining();
+  };
+
+  // Feasible polyhedra, computed once and sorted by how promising they are.
+  // The current strategies are read before any country QP changes.
+  arma::vec guess = this->sol_x;
+  if (guess.n_elem != this->nVarinEPEC)
+    guess.zeros(this->nVarinEPEC);
+  std::vector<std::vector<long int>> feasPolys(this->nCountr);
+  for (unsigned int i = 0; i < this->nCountr; ++i) {
+    if (combination.at(i) >= 0)
+      feasPolys.at(i).push_back(combination.at(i));
+    else if (!candidates.empty()) {
+      for (const auto poly : candidates.at(i))
+        if (this->countries_LCP.at(i)->checkPolyFeas(
+                static_cast<unsigned long int>(poly)))
+          feasPolys.at(i).push_back(poly);
+    } else {
+      for (unsigned int j = 0;
+           j < this->countries_LCP.at(i)->getNumTheoreticalPoly(); ++j)
+        if (this->countries_LCP.at(i)->checkPolyFeas(j))
+          feasPolys.at(i).push_back(j);
+    }
+    if (feasPolys.at(i).empty()) {
+      BOOST_LOG_TRIVIAL(info) << "Game::EPEC::combinatorial_pure_NE: country "
+                              << i << " has no feasible polyhedron";
+      this->Stats.status = Game::EPECsolveStatus::nashEqNotFound;
       return;
     }
+    feasPolys.at(i) = this->orderCombinatorialPolys(i, feasPolys.at(i), guess);
   }
-
-  std::vector<long int> childCombination(combination);
-  bool found{false};
-  unsigned int i{0};
-  for (i = 0; i < this->getNcountries(); i++) {
-    if (childCombination.at(i) == -1) {
-      found = true;
-      break;
+  // Fail first: countries with fewer polyhedra are fixed first
+  std::vector<unsigned int> countryOrder(this->nCountr);
+  std::iota(countryOrder.begin(), countryOrder.end(), 0);
+  std::stable_sort(countryOrder.begin(), countryOrder.end(),
+                   [&feasPolys](unsigned int a, unsigned int b) {
+                     return feasPolys.at(a).size() < feasPolys.at(b).size();
+                   });
+
+  // The QP of each polyhedron, and the relaxation used for pruning: a zero
+  // objective over the LCP without complementarity (see
+  // Game::LCP::commonConstraints)
+  std::vector<std::map<long int, std::shared_ptr<Game::QP_Param>>> polyQP(
+      this->nCountr);
+  std::vector<std::shared_ptr<Game::QP_Param>> relaxedQP(this->nCountr);
+  for (unsigned int i = 0; i < this->nCountr; ++i) {
+    for (const auto poly : feasPolys.at(i)) {
+      this->countries_LCP.at(i)->clearPolyhedra();
+      this->countries_LCP.at(i)->addThePoly(poly);
+      this->make_country_QP(i);
+      polyQP.at(i)[poly] = this->country_QP.at(i);
     }
+    const auto &qp = *this->country_QP.at(i);
+    arma::sp_mat B;
+    arma::vec b;
+    this->countries_LCP.at(i)->commonConstraints(B, b);
+    relaxedQP.at(i) = std::make_shared<Game::QP_Param>(
+        arma::sp_mat(qp.getNy(), qp.getNy()),
+        arma::sp_mat(qp.getNy(), qp.getNx()),
+        arma::sp_mat(B.n_rows, qp.getNx()), B,
+        arma::vec(qp.getNy(), arma::fill::zeros), b, this->env);
   }
-  if (found) {
-    for (unsigned int j = 0;
-         j < this->countries_LCP.at(i)->getNumTheoreticalPoly(); ++j) {
-      if (this->countries_LCP.at(i)->checkPolyFeas(j)) {
-        childCombination.at(i) = j;
-        this->combinatorial_pure_NE(childCombination, excludeList);
+  this->updateConvexHullLocs();
+  const int Nvar =
+      this->country_QP.front()->getNx() + this->country_QP.front()->getNy();
+  arma::sp_mat MC(0, Nvar);
+  arma::vec MCRHS;
+  MCRHS.zeros(0);
+  this->make_MC_cons(MC, MCRHS);
+
+  const unsigned int nWorkers =
+      this->Stats.AlgorithmParam.threads > 0
+          ? this->Stats.AlgorithmParam.threads
+          : std::max(1u, std::thread::hardware_concurrency());
+  std::vector<std::deque<std::vector<long int>>> queues(nWorkers);
+  std::vector<std::mutex> queueMutex(nWorkers);
+  // Tasks not yet finished, and tasks waiting in some deque
+  std::atomic<long int> pending{1}, queued{1};
+  std::atomic<bool> stop{false}, outOfTime{false};
+  std::atomic<unsigned int> pruned{0}, evaluated{0};
+  std::mutex foundMutex;
+  std::vector<long int> found{};
+  queues.front().push_back(combination);
+  // Idle workers sleep until a task is pushed or the search is over
+  std::mutex idleMutex;
+  std::condition_variable idle;
+  const auto wakeIdle = [&idleMutex, &idle]() {
+    { std::lock_guard<std::mutex> lock(idleMutex); }
+    idle.notify_all();
+  };
+
+  const auto excluded = [&excludeList, this](const std::vector<long int> &c) {
+    if (excludeList.empty())
+      return false;
+    for (unsigned int j = 0; j < this->nCountr; ++j)
+      if (excludeList.at(j).find(c.at(j)) == excludeList.at(j).end())
+        return false;
+    return true;
+  };
+
+  auto worker = [&](const unsigned int w) {
+    try {
+      GRBEnv workerEnv;
+      workerEnv.set(GRB_IntParam_Threads, 1);
+      workerEnv.set(GRB_IntParam_OutputFlag, 0);
+      std::vector<std::unique_ptr<Game::LCP>> workerLCP{};
+      for (unsigned int i = 0; i < this->nCountr; ++i) {
+        workerLCP.push_back(std::unique_ptr<Game::LCP>(
+            new LCP(&workerEnv, *this->countries_LL.at(i).get())));
+        workerLCP.back()->deadline = &this->deadline;
       }
-    }
-  } else {
-    // Combination is filled and ready!
-    // Check that this combination is not in the excuded list
-    BOOST_LOG_TRIVIAL(trace)
-        << "Game::EPEC::combinatorial_pure_NE: considering a FULL combination";
-    bool excluded = false;
-    if (!excludeList.empty()) {
-      excluded = true;
-      for (unsigned int j = 0; j < this->nCountr; ++j) {
-        if (excludeList.at(j).find(childCombination.at(j)) ==
-            excludeList.at(j).end()) {
-          excluded = false;
+      // Last polyhedron where each country found a profitable deviation
+      std::vector<long int> lastDevn(this->nCountr, -1);
+
+      while (!stop && pending > 0) {
+        std::vector<long int> task;
+        bool got{false};
+        // Own deque first (depth first), then steal the oldest task elsewhere
+        for (unsigned int k = 0; k < nWorkers && !got; ++k) {
+          const unsigned int q = (w + k) % nWorkers;
+          std::lock_guard<std::mutex> lock(queueMutex.at(q));
+          if (queues.at(q).empty())
+            continue;
+          if (k == 0) {
+            task = std::move(queues.at(q).back());
+            queues.at(q).pop_back();
+          } else {
+            task = std::move(queues.at(q).front());
+            queues.at(q).pop_front();
+          }
+          --queued;
+          got = true;
+        }
+        if (!got) {
+          std::unique_lock<std::mutex> lock(idleMutex);
+          idle.wait(lock, [&]() { return stop || pending <= 0 || queued > 0; });
+          continue;
         }
+        const double remaining = timeRemaining();
+        if (remaining == 0) {
+          outOfTime = true;
+          stop = true;
+        } else {
+          const auto free =
+              std::find_if(countryOrder.begin(), countryOrder.end(),
+                           [&task](unsigned int i) { return task.at(i) < 0; });
+          const bool partial = free != countryOrder.end();
+          const bool anyFixed =
+              std::any_of(task.begin(), task.end(),
+                          [](long int poly) { return poly >= 0; });
+          std::vector<std::shared_ptr<Game::QP_Param>> QPs{};
+          for (unsigned int i = 0; i < this->nCountr; ++i)
+            QPs.push_back(task.at(i) >= 0 ? polyQP.at(i).at(task.at(i))
+                                          : relaxedQP.at(i));
+          if (partial && anyFixed &&
+              this->Stats.AlgorithmParam.combinatorialPruning &&
+              !this->isPartialCombinationFeasible(QPs, MC, MCRHS, &workerEnv,
+                                                  remaining)) {
+            BOOST_LOG_TRIVIAL(trace) << "Game::EPEC::combinatorial_pure_NE: "
+                                        "partial configuration pruned.";
+            ++pruned;
+          } else if (partial) {
+            const unsigned int i = *free;
+            {
+              std::lock_guard<std::mutex> lock(queueMutex.at(w));
+              // In reverse, so that the children are popped in order
+              for (auto it = feasPolys.at(i).rbegin();
+                   it != feasPolys.at(i).rend(); ++it) {
+                task.at(i) = *it;
+                ++pending;
+                ++queued;
+                queues.at(w).push_back(task);
+              }
+            }
+            wakeIdle();
+          } else if (excluded(task)) {
+            BOOST_LOG_TRIVIAL(trace)
+                << "Game::EPEC::combinatorial_pure_NE: configuration pruned.";
+          } else {
+            ++evaluated;
+            if (this->isPureNECombination(QPs, MC, MCRHS, &workerEnv,
+                                          workerLCP, task, feasPolys, lastDevn,
+                                          remaining)) {
+              std::lock_guard<std::mutex> lock(foundMutex);
+              if (found.empty())
+                found = task;
+              stop = true;
+            }
+          }
+        }
+        if (--pending <= 0 || stop)
+          wakeIdle();
       }
+    } catch (...) {
+      stop = true;
+      wakeIdle();
+      throw;
     }
+  };
 
-    if (!excluded) {
-      BOOST_LOG_TRIVIAL(trace)
-          << "Game::EPEC::combinatorial_pure_NE: considering a "
-             "FEASIBLE combination of polyhedra.";
-      for (unsigned int j = 0; j < this->getNcountries(); ++j) {
-        this->countries_LCP.at(j)->clearPolyhedra();
-        this->countries_LCP.at(j)->addThePoly(childCombination.at(j));
-      }
-      this->make_country_QP();
-      bool res = false;
-      if (this->Stats.AlgorithmParam.timeLimit > 0) {
-        const std::chrono::duration<double> timeElapsed =
-            std::chrono::high_resolution_clock::now() - this->initTime;
-        const double timeRemaining =
-            this->Stats.AlgorithmParam.timeLimit - timeElapsed.count();
-        res = this->computeNashEq(false, timeRemaining, true);
-      } else
-        res = this->computeNashEq(false, -1.0, true);
+  std::vector<std::future<void>> workers;
+  for (unsigned int w = 0; w < nWorkers; ++w)
+    workers.push_back(std::async(std::launch::async, worker, w));
+  try {
+    for (auto &w : workers)
+      w.get();
+  } catch (string &e) {
+    cerr << "String in Game::EPEC::combinatorial_pure_NE : " << e << '\n';
+    throw;
+  } catch (GRBException &e) {
+    cerr << "GRBException in Game::EPEC::combinatorial_pure_NE : "
+         << e.getErrorCode() << ": " << e.getMessage() << '\n';
+    throw;
+  } catch (exception &e) {
+    cerr << "Exception in Game::EPEC::combinatorial_pure_NE : " << e.what()
+         << '\n';
+    throw;
+  }
 
-      if (res) {
-        if (this->isSolved(this->Stats.AlgorithmParam.solvedTol)) {
-          // Check that the equilibrium is a pure strategy
-          if ((this->isPureStrategy())) {
-            BOOST_LOG_TRIVIAL(info)
-                << "Game::EPEC::combinatorial_pure_NE: found a pure strategy.";
-            this->Stats.status = Game::EPECsolveStatus::nashEqFound;
-            this->Stats.pureNE = true;
-            return;
-          }
-        }
+  this->Stats.prunedCombinations += pruned;
+  this->Stats.evaluatedCombinations += evaluated;
+  if (found.empty()) {
+    this->Stats.status = outOfTime ? Game::EPECsolveStatus::timeLimit
+                                   : Game::EPECsolveStatus::nashEqNotFound;
+    return;
+  }
+  for (unsigned int j = 0; j < this->nCountr; ++j) {
+    this->countries_LCP.at(j)->clearPolyhedra();
+    this->countries_LCP.at(j)->addThePoly(found.at(j));
+  }
+  this->make_country_QP();
+  // The confirmation is run to the end, even past the time limit
+  if (this->computeNashEq(false, -1.0, true) &&
+      this->isSolved(this->Stats.AlgorithmParam.solvedTol) &&
+      this->isPureStrategy()) {
+    BOOST_LOG_TRIVIAL(info)
+        << "Game::EPEC::combinatorial_pure_NE: found a pure strategy.";
+    this->Stats.status = Game::EPECsolveStatus::nashEqFound;
+    this->Stats.pureNE = true;
+  } else {
+    BOOST_LOG_TRIVIAL(warning) << "Game::EPEC::combinatorial_pure_NE: the pure "
+                                  "NE found by a worker cannot be confirmed";
+    this->Stats.numericalIssuesEncountered = true;
+    this->Stats.status = Game::EPECsolveStatus::numerical;
+  }
+}
+
+bool Game::EPEC::supportReductionPNE() {
+  /**
+   * @brief Searches for a pure NE close to the mixed NE just found by
+   * Game::EPEC::iterativeNash
+   * @details The polyhedra played with positive probability by each country
+   * (see Game::EPEC::mixedStratPoly) form its support. Its neighbours are the
+   * feasible polyhedra whose encoding differs from one in the support by a
+   * single complementarity condition. Game::EPEC::combinatorial_pure_NE is
+   * then run, in order:
+   *  - on the combinations within the support,
+   *  - for each country, on the combinations where that country plays a
+   * neighbour, and the others stay within the support.
+   * @returns true if the search is over, i.e., a pure NE was found or time is
+   * up. If false, a wider search is needed.
+   */
+  std::vector<std::vector<long int>> support(this->nCountr);
+  std::vector<std::vector<long int>> neighbours(this->nCountr);
+  for (unsigned int i = 0; i < this->nCountr; ++i) {
+    const auto &order = this->countries_LCP.at(i)->getPolyOrder();
+    for (const auto j : this->mixedStratPoly(i))
+      if (j < order.size())
+        support.at(i).push_back(static_cast<long int>(order.at(j)));
+    if (support.at(i).empty()) {
+      BOOST_LOG_TRIVIAL(warning)
+          << "Game::EPEC::supportReductionPNE: unknown support for country "
+          << i;
+      return false;
+    }
+  }
+  for (unsigned int i = 0; i < this->nCountr; ++i) {
+    auto &LCP_i = this->countries_LCP.at(i);
+    const unsigned int nCompl = LCP_i->getCompl().size();
+    std::set<long int> seen(support.at(i).begin(), support.at(i).end());
+    for (const auto poly : support.at(i)) {
+      auto encoding = Utils::num_to_vec(poly, nCompl);
+      for (auto &fix : encoding) {
+        fix = -fix;
+        const auto neighbour =
+            static_cast<long int>(Utils::vec_to_num(encoding));
+        fix = -fix;
+        if (seen.insert(neighbour).second &&
+            LCP_i->checkPolyFeas(static_cast<unsigned long int>(neighbour)))
+          neighbours.at(i).push_back(neighbour);
       }
-    } else {
-      BOOST_LOG_TRIVIAL(trace)
-          << "Game::EPEC::combinatorial_pure_NE: configuration pruned.";
-      return;
     }
+    BOOST_LOG_TRIVIAL(debug)
+        << "Game::EPEC::supportReductionPNE: country " << i << " has "
+        << support.at(i).size() << " polyhedra in the support and "
+        << neighbours.at(i).size() << " neighbours";
+  }
+
+  const std::vector<long int> start(this->nCountr, -1);
+  const auto over = [this]() {
+    return this->Stats.status == Game::EPECsolveStatus::nashEqFound ||
+           this->Stats.status == Game::EPECsolveStatus::timeLimit;
+  };
+  this->combinatorial_pure_NE(start, {}, support);
+  for (unsigned int i = 0; i < this->nCountr && !over(); ++i) {
+    if (neighbours.at(i).empty())
+      continue;
+    auto candidates = support;
+    candidates.at(i) = neighbours.at(i);
+    this->combinatorial_pure_NE(start, {}, candidates);
+  }
+  if (this->Stats.status == Game::EPECsolveStatus::nashEqFound)
+    BOOST_LOG_TRIVIAL(info) << "Game::EPEC::supportReductionPNE: pure NE "
+                               "found next to the mixed NE";
+  return over();
+}
+
+std::vector<long int> Game::EPEC::orderCombinatorialPolys(
+    const unsigned int i,        ///< The country
+    std::vector<long int> polys, ///< Decimal encoding of its polyhedra
+    const arma::vec &x           ///< The current strategies of all countries
+) const {
+  /**
+   * @brief Sorts the polyhedra of the @p i-th country, most promising first
+   * @details Polyhedra played with a larger weight in the last master solution
+   * (see Game::EPEC::saveMasterStart) come first. Ties are broken by the
+   * optimal value of the leader's problem restricted to the polyhedron, given
+   * the other countries' strategies in @p x (see Game::LCP::MPECasQP).
+   */
+  arma::vec solOther;
+  this->get_x_minus_i(x, i, solOther);
+  std::map<long int, std::pair<double, double>> key{};
+  for (const auto poly : polys) {
+    double weight{0};
+    if (this->startPolySol.size() == this->nCountr) {
+      const auto known = this->startPolySol.at(i).find(poly);
+      if (known != this->startPolySol.at(i).end())
+        weight = known->second.first;
+    }
+    double bound{GRB_INFINITY};
+    auto model = this->countries_LCP.at(i)->MPECasQP(
+        static_cast<unsigned long int>(poly), this->LeadObjec.at(i)->Q,
+        this->LeadObjec.at(i)->C, this->LeadObjec.at(i)->c, solOther, true);
+    if (model->get(GRB_IntAttr_Status) == GRB_OPTIMAL)
+      bound = model->get(GRB_DoubleAttr_ObjVal);
+    key[poly] = {-weight, bound};
   }
+  std::stable_sort(polys.begin(), polys.end(), [&key](long int a, long int b) {
+    return key.at(a) < key.at(b);
+  });
+  return polys;
+}
+
+std::unique_ptr<Game::NashGame> Game::EPEC::makeWorkerNashGame(
+    const std::vector<std::shared_ptr<Game::QP_Param>>
+        &QPs,               ///< The QP of each country
+    const arma::sp_mat &MC, ///< Market clearing constraints
+    const arma::vec &MCRHS, ///< RHS of the market clearing constraints
+    GRBEnv *workerEnv       ///< The Gurobi environment of the calling worker
+) const {
+  /**
+   * @brief Makes the Game::NashGame among copies of @p QPs living in
+   * @p workerEnv
+   * @details Used by the workers of Game::EPEC::combinatorial_pure_NE, which
+   * cannot share Gurobi environments.
+   */
+  std::vector<std::shared_ptr<Game::QP_Param>> workerQPs{};
+  for (const auto &qp : QPs)
+    workerQPs.push_back(std::make_shared<Game::QP_Param>(
+        qp->getQ(), qp->getC(), qp->getA(), qp->getB(), qp->getc(),
+        qp->getb(), workerEnv));
+  arma::sp_mat dumA(0, MC.n_cols);
+  arma::vec dumb;
+  dumb.zeros(0);
+  return std::unique_ptr<Game::NashGame>(
+      new Game::NashGame(workerEnv, workerQPs, MC, MCRHS, 0, dumA, dumb));
+}
+
+bool Game::EPEC::isPartialCombinationFeasible(
+    const std::vector<std::shared_ptr<Game::QP_Param>>
+        &QPs,               ///< The QP of each country
+    const arma::sp_mat &MC, ///< Market clearing constraints
+    const arma::vec &MCRHS, ///< RHS of the market clearing constraints
+    GRBEnv *workerEnv,      ///< The Gurobi environment of the calling worker
+    double localTimeLimit   ///< Time limit for the master, if positive
+) const {
+  /**
+   * @brief Checks whether a partial combination of polyhedra can still lead to
+   * a pure NE
+   * @details @p QPs holds the single polyhedron QP of the countries already
+   * fixed, and the relaxation of Game::EPEC::combinatorial_pure_NE for the
+   * others, that is a zero objective over their LCP without complementarity.
+   * Any pure NE extending the combination is feasible for this master, hence
+   * the combination is pruned if the master is infeasible.
+   * @returns false only if the master is proven infeasible
+   */
+  auto nash = this->makeWorkerNashGame(QPs, MC, MCRHS, workerEnv);
+  Game::LCP lcp(workerEnv, *nash);
+  lcp.useIndicators = this->Stats.AlgorithmParam.indicators;
+  lcp.deadline = &this->deadline;
+  auto model = lcp.LCPasMIP(false);
+  if (localTimeLimit > 0)
+    model->set(GRB_DoubleParam_TimeLimit, localTimeLimit);
+  model->optimize();
+  const int status = model->get(GRB_IntAttr_Status);
+  return !(status == GRB_INFEASIBLE || status == GRB_INF_OR_UNBD);
 }
 
-void ::Game::EPEC::make_country_LCP() {
+bool Game::EPEC::isPureNECombination(
+    const std::vector<std::shared_ptr<Game::QP_Param>>
+        &QPs,               ///< The single polyhedron QP of each country
+    const arma::sp_mat &MC, ///< Market clearing constraints
+    const arma::vec &MCRHS, ///< RHS of the market clearing constraints
+    GRBEnv *workerEnv,      ///< The Gurobi environment of the calling worker
+    const std::vector<std::unique_ptr<Game::LCP>>
+        &workerLCP, ///< The calling worker's copy of each country's LCP
+    const std::vector<long int>
+        &combination, ///< The polyhedron of each country in @p QPs
+    const std::vector<std::vector<long int>>
+        &screenPolys, ///< Feasible polyhedra of each country, for the screen
+    std::vector<long int>
+        &lastDevn,        ///< The calling worker's memory for the screen
+    double localTimeLimit ///< Time limit for the master, if positive
+) {
+  /**
+   * @brief Checks whether a pure NE exists where each country plays in the
+   * polyhedron of its QP in @p QPs
+   * @details With a single polyhedron per country, the master is the LCP of a
+   * Nash game among convex QPs. It is first solved with Lemke's method (see
+   * Game::LCP::solveLemke), and the master MIP is only built in @p workerEnv
+   * if the pivoting fails. Nothing touches the state of the object, so that
+   * several workers can run this at once (see
+   * Game::EPEC::combinatorial_pure_NE). Each master solution is first
+   * screened by Game::EPEC::screenCombination, and only the ones surviving
+   * the screen are verified with the best responses computed on
+   * @p workerLCP. The verified points are offered as the incumbent (see
+   * Game::EPEC::updateIncumbent).
+   */
+  auto nashPtr = this->makeWorkerNashGame(QPs, MC, MCRHS, workerEnv);
+  const Game::NashGame &nash = *nashPtr;
+  Game::LCP lcp(workerEnv, nash);
+  lcp.useIndicators = this->Stats.AlgorithmParam.indicators;
+  lcp.deadline = &this->deadline;
+
+  const auto isPureNE = [&](const arma::vec &x) {
+    const arma::vec objvals = nash.ComputeQPObjvals(x, true);
+    if (this->screenCombination(x, objvals, combination, screenPolys,
+                                workerLCP, lastDevn))
+      return false;
+    bool solved{true};
+    // Past the first profitable deviation, the remaining responses are only
+    // computed while the point may still improve the incumbent
+    std::vector<double> regret(this->nCountr, GRB_INFINITY);
+    double maxRegret{0};
+    for (unsigned int i = 0; i < this->nCountr; ++i) {
+      if (!solved && maxRegret >= this->incumbentMaxRegret())
+        break;
+      arma::vec solOther;
+      this->get_x_minus_i(x, i, solOther);
+      auto response = workerLCP.at(i)->MPECasMIQP(
+          this->LeadObjec.at(i)->Q, this->LeadObjec.at(i)->C,
+          this->LeadObjec.at(i)->c, solOther, true);
+      if (response->get(GRB_IntAttr_Status) == GRB_OPTIMAL)
+        regret.at(i) =
+            std::max(0.0, objvals.at(i) - responseBound(*response));
+      maxRegret = std::max(maxRegret, regret.at(i));
+      solved = solved && response->get(GRB_IntAttr_Status) == GRB_OPTIMAL &&
+               abs(response->get(GRB_DoubleAttr_ObjVal) - objvals.at(i)) <=
+                   this->Stats.AlgorithmParam.solvedTol;
+    }
+    arma::vec MC{};
+    const auto leadFoll = this->getLeadFoll(x, MC);
+    this->updateIncumbent(leadFoll, MC, regret);
+    return solved;
+  };
+
+  arma::vec z, x;
+  bool bounded{true};
+  if (lcp.solveLemke(z, x)) {
+    if (this->Stats.AlgorithmParam.boundPrimals)
+      for (unsigned int c = 0; c < nash.getNprimals(); c++)
+        bounded = bounded && x.at(c) <= this->Stats.AlgorithmParam.boundBigM;
+    if (bounded)
+      return isPureNE(x);
+  }
+
+  auto model = lcp.LCPasMIP(false);
+  if (localTimeLimit > 0)
+    model->set(GRB_DoubleParam_TimeLimit, localTimeLimit);
+  if (this->Stats.AlgorithmParam.boundPrimals) {
+    for (unsigned int c = 0; c < nash.getNprimals(); c++)
+      model->getVarByName("x_" + to_string(c))
+          .set(GRB_DoubleAttr_UB, this->Stats.AlgorithmParam.boundBigM);
+  }
+  model->setObjective(GRBLinExpr{0});
+  model->update();
+  GRBQuadExpr obj =
+      this->make_lcp_objective(model.get()) + model->getObjective();
+  model->setObjective(obj);
+  model->set(GRB_IntParam_SolutionLimit, GRB_MAXINT);
+  model->optimize();
+
+  for (int k = 0; lcp.extractSols(model.get(), z, x, true, k); ++k)
+    if (isPureNE(x))
+      return true;
+  return false;
+}
+
+bool Game::EPEC::screenCombination(
+    const arma::vec &x,       ///< Strategies of all the countries
+    const arma::vec &objvals, ///< Objective of each country at @p x
+    const std::vector<long int>
+        &combination, ///< The polyhedron of each country at @p x
+    const std::vector<std::vector<long int>>
+        &screenPolys, ///< Feasible polyhedra of each country
+    const std::vector<std::unique_ptr<Game::LCP>>
+        &workerLCP, ///< The calling worker's copy of each country's LCP
+    std::vector<long int> &lastDevn ///< [in/out] Last polyhedron where each
+                                    ///< country found a profitable deviation
+) const {
+  /**
+   * @brief Cheap rejection of a candidate pure NE
+   * @details Runs on the point found by Game::EPEC::isPureNECombination, which
+   * usually comes from Lemke's method rather than a MIP, so that rejected
+   * combinations cost a pivoting and a few LPs or QPs. The best response of
+   * a country restricted to any other of its polyhedra is an LP or a convex
+   * QP (see Game::LCP::MPECasQP). These are solved, starting from the
+   * polyhedron in @p lastDevn, until one of them improves the objective of the
+   * country by more than Game::EPECAlgorithmParams::solvedTol. Since the same
+   * polyhedra tend to reject many combinations, this is usually much faster
+   * than the MIQP best response of Game::EPEC::isPureNECombination.
+   * @returns true if a profitable deviation was found
+   */
+  const double tol = this->Stats.AlgorithmParam.solvedTol;
+  for (unsigned int i = 0; i < this->nCountr; ++i) {
+    arma::vec solOther;
+    this->get_x_minus_i(x, i, solOther);
+    std::vector<long int> polys{};
+    if (lastDevn.at(i) >= 0)
+      polys.push_back(lastDevn.at(i));
+    for (const auto poly : screenPolys.at(i))
+      if (poly != lastDevn.at(i))
+        polys.push_back(poly);
+    for (const auto poly : polys) {
+      if (poly == combination.at(i))
+        continue;
+      auto model = workerLCP.at(i)->MPECasQP(
+          static_cast<unsigned long int>(poly), this->LeadObjec.at(i)->Q,
+          this->LeadObjec.at(i)->C, this->LeadObjec.at(i)->c, solOther, true);
+      if (model->get(GRB_IntAttr_Status) == GRB_OPTIMAL &&
+          model->get(GRB_DoubleAttr_ObjVal) < objvals.at(i) - tol) {
+        BOOST_LOG_TRIVIAL(trace)
+            << "Game::EPEC::screenCombination: country " << i
+            << " deviates to polyhedron " << poly;
+        lastDevn.at(i) = poly;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void ::Game::EPEC::make_country_LCP(bool makeModel) {
   if (this->country_QP.front() == nullptr) {
     BOOST_LOG_TRIVIAL(error) << "Exception in Game::EPEC::make_country_LCP : "
                                 "no country QP has been "
@@ -1966,6 +3404,7 @@ void ::Game::EPEC::make_country_LCP() {
   BOOST_LOG_TRIVIAL(trace)
       << "Game::EPEC::make_country_LCP(): NashGame is ready";
   this->lcp = std::unique_ptr<Game::LCP>(new Game::LCP(this->env, *nashgame));
+  this->lcp->deadline = &this->deadline;
   BOOST_LOG_TRIVIAL(trace) << "Game::EPEC::make_country_LCP(): LCP is ready";
   BOOST_LOG_TRIVIAL(trace)
       << "Game::EPEC::make_country_LCP(): indicators set to "
@@ -1973,13 +3412,47 @@ void ::Game::EPEC::make_country_LCP() {
   this->lcp->useIndicators =
       this->Stats.AlgorithmParam.indicators; // Using indicator constraints
 
-  this->lcpmodel = this->lcp->LCPasMIP(false);
+  if (makeModel)
+    this->lcpmodel = this->lcp->LCPasMIP(false);
+  else
+    this->lcpmodel.reset();
 
   BOOST_LOG_TRIVIAL(trace) << *nashgame;
 }
 
 GRBQuadExpr Game::EPEC::make_lcp_objective(GRBModel *) { return 0; }
 
+namespace {
+/// @brief Records whether Gurobi turned the user MIP start into an incumbent,
+/// and stops the solve as soon as the deadline is cancelled
+/// @details The start is deemed accepted if a new incumbent agrees with it on
+/// every variable it sets. This relies on the solutions passed to the
+/// callback only, not on Gurobi's log.
+class MIPStartMonitor : public GRBCallback {
+public:
+  bool accepted{false};
+  const Game::Deadline *deadline{nullptr};
+  std::vector<GRBVar> startVars{}; ///< Variables set by the MIP start
+  std::vector<double> startVals{}; ///< Their values in the MIP start
+
+protected:
+  void callback() override {
+    if (deadline && deadline->isCancelled()) {
+      abort();
+      return;
+    }
+    if (where != GRB_CB_MIPSOL || accepted || startVars.empty())
+      return;
+    const std::unique_ptr<double[]> sol(
+        getSolution(startVars.data(), startVars.size()));
+    for (unsigned int k = 0; k < startVars.size(); ++k)
+      if (std::abs(sol[k] - startVals.at(k)) > 1e-5)
+        return;
+    accepted = true;
+  }
+};
+} // namespace
+
 bool Game::EPEC::computeNashEq(
     bool pureNE,           ///< True if we search for a PNE
     double localTimeLimit, ///< Allowed time limit to run this function
@@ -1995,10 +3468,25 @@ bool Game::EPEC::computeNashEq(
    */
   // Make the Nash Game between countries
   this->nashEq = false;
+  // The MIP of the master is only made if the decomposition fails
+  const bool decompose =
+      this->Stats.AlgorithmParam.masterDecomposition > 0 && !pureNE && !check;
   BOOST_LOG_TRIVIAL(trace)
       << " Game::EPEC::computeNashEq: Making the Master LCP";
-  this->make_country_LCP();
+  this->make_country_LCP(!decompose);
   BOOST_LOG_TRIVIAL(trace) << " Game::EPEC::computeNashEq: Made the Master LCP";
+  if (decompose) {
+    if (this->decomposedNashEq()) {
+      this->nashEq = true;
+      ++this->Stats.decomposedMasters;
+      this->masterPoolSols.clear();
+      this->saveMasterStart();
+      return true;
+    }
+    BOOST_LOG_TRIVIAL(info) << "Game::EPEC::computeNashEq: the decomposition "
+                               "did not converge. Solving the master LCP.";
+    this->lcpmodel = this->lcp->LCPasMIP(false);
+  }
   if (localTimeLimit > 0) {
     this->lcpmodel->set(GRB_DoubleParam_TimeLimit, localTimeLimit);
   }
@@ -2022,10 +3510,37 @@ bool Game::EPEC::computeNashEq(
   this->lcpmodel->setObjective(obj);
 
   this->lcpmodel->set(GRB_IntParam_OutputFlag, 1);
+  const unsigned int poolSize{this->Stats.AlgorithmParam.masterPoolSize};
+  this->masterPoolSols.clear();
   if (check)
     this->lcpmodel->set(GRB_IntParam_SolutionLimit, GRB_MAXINT);
+  else if (poolSize > 1) {
+    // Keep the other solutions found by the master, to harvest deviations
+    // from several candidate equilibria at once. The pool is filled on a best
+    // effort basis only, so that the master is not slowed down
+    this->lcpmodel->set(GRB_IntParam_SolutionLimit, GRB_MAXINT);
+    this->lcpmodel->set(GRB_IntParam_PoolSolutions, poolSize);
+    this->lcpmodel->set(GRB_IntParam_PoolSearchMode, 1);
+  }
+  MIPStartMonitor startMonitor;
+  startMonitor.deadline = &this->deadline;
+  const bool started =
+      this->Stats.AlgorithmParam.masterMIPStart &&
+      this->setMasterStart(startMonitor.startVars, startMonitor.startVals);
+  this->lcpmodel->setCallback(&startMonitor);
+  if (this->currentMIPGap() > 0)
+    this->lcpmodel->set(GRB_DoubleParam_MIPGap, this->currentMIPGap());
   this->lcpmodel->optimize();
+  this->lcpmodel->setCallback(nullptr);
   this->Stats.wallClockTime += this->lcpmodel->get(GRB_DoubleAttr_Runtime);
+  if (started) {
+    ++this->Stats.masterStarts;
+    if (startMonitor.accepted)
+      ++this->Stats.masterStartsAccepted;
+    BOOST_LOG_TRIVIAL(info)
+        << "Game::EPEC::computeNashEq: MIP start from the previous master was "
+        << (startMonitor.accepted ? "accepted" : "rejected");
+  }
 
   // Search just for a feasible point
   try { // Try finding a Nash equilibrium for the approximation
@@ -2043,9 +3558,8 @@ bool Game::EPEC::computeNashEq(
       BOOST_LOG_TRIVIAL(info)
           << "Game::EPEC::computeNashEq: number of equilibria is " << scount;
       for (int k = 0, stop = 0; k < scount && stop == 0; ++k) {
-        this->lcpmodel->getEnv().set(GRB_IntParam_SolutionNumber, k);
-        this->nashEq =
-            this->lcp->extractSols(this->lcpmodel.get(), sol_z, sol_x, true);
+        this->nashEq = this->lcp->extractSols(this->lcpmodel.get(), sol_z,
+                                              sol_x, true, k);
         if (this->isSolved(this->Stats.AlgorithmParam.solvedTol)) {
           BOOST_LOG_TRIVIAL(info)
               << "Game::EPEC::computeNashEq: an Equilibrium has been found";
@@ -2056,13 +3570,32 @@ bool Game::EPEC::computeNashEq(
       this->nashEq = true;
       BOOST_LOG_TRIVIAL(info)
           << "Game::EPEC::computeNashEq: an Equilibrium has been found";
+      if (poolSize > 1) {
+        // Only one solution per support is worth a round of best responses
+        std::set<std::vector<std::vector<unsigned int>>> supports{
+            this->getSupport(this->sol_x)};
+        const int scount = this->lcpmodel->get(GRB_IntAttr_SolCount);
+        for (int k = 1; k < scount; ++k) {
+          arma::vec poolZ, poolX;
+          if (!this->lcp->extractSols(this->lcpmodel.get(), poolZ, poolX, false,
+                                      k))
+            continue;
+          if (supports.insert(this->getSupport(poolX)).second)
+            this->masterPoolSols.push_back(poolX);
+        }
+        this->Stats.masterPoolSolutions += this->masterPoolSols.size();
+        BOOST_LOG_TRIVIAL(info)
+            << "Game::EPEC::computeNashEq: " << this->masterPoolSols.size()
+            << " further master solutions with a distinct support";
+      }
     }
 
+    this->saveMasterStart();
   } else { // If not, then update accordingly
     BOOST_LOG_TRIVIAL(info)
         << "Game::EPEC::computeNashEq: no equilibrium has been found.";
     int status = this->lcpmodel->get(GRB_IntAttr_Status);
-    if (status == GRB_TIME_LIMIT)
+    if (status == GRB_TIME_LIMIT || status == GRB_INTERRUPTED)
       this->Stats.status = Game::EPECsolveStatus::timeLimit;
     else
       this->Stats.status = Game::EPECsolveStatus::nashEqNotFound;
@@ -2070,6 +3603,216 @@ bool Game::EPEC::computeNashEq(
   return this->nashEq;
 }
 
+bool Game::EPEC::decomposedNashEq() {
+  /**
+   * @brief Computes an equilibrium of the master LCP by price coordination
+   * across the countries
+   * @details The countries are only coupled through the market clearing
+   * constraints and their shadow prices, and through the other countries'
+   * variables in their objectives. In each round, every country solves its
+   * convex hull QP (see Game::QP_Param::solveFixed) against the prices and the
+   * other countries' variables of the previous round, in parallel if each
+   * country has its own Gurobi environment (see
+   * Game::EPECAlgorithmParams::pipelined). The coordinator then moves the
+   * prices against the residuals of the market clearing constraints, with a
+   * diminishing step. The prices are kept for the next master.
+   *
+   * The primal and dual solutions of the QPs and the prices make a point of
+   * the master LCP, which is accepted as soon as it satisfies the LCP within
+   * the tolerance. Up to Game::EPECAlgorithmParams::masterDecomposition
+   * rounds are run.
+   * @returns true if an equilibrium of the master LCP was found, in which case
+   * Game::EPEC::sol_x and Game::EPEC::sol_z hold it
+   */
+  constexpr double tol{1e-5};
+  const unsigned int rounds = this->Stats.AlgorithmParam.masterDecomposition;
+  const arma::sp_mat M = this->lcp->getM();
+  const arma::vec q = this->lcp->getq();
+  const perps Compl = this->lcp->getCompl();
+  const unsigned int nShadow = this->nashgame->getNshadow();
+  const unsigned int MCLoc = this->nashgame->getMCdualLoc();
+  const unsigned int othersEnd = this->nashgame->getDualLoc(0);
+  const bool parallel = this->countryEnvs.size() == this->nCountr;
+
+  arma::vec x(this->lcp->getNcol(), arma::fill::zeros);
+  if (nShadow > 0 && this->decompositionPrices.n_elem == nShadow)
+    x.subvec(MCLoc, MCLoc + nShadow - 1) = this->decompositionPrices;
+  std::vector<char> solved(this->nCountr, 0);
+  for (unsigned int round = 0; round < rounds; ++round) {
+    if (Game::EPEC::stopRequested() || this->deadline.expired())
+      return false;
+    const arma::vec previous = x;
+    auto countryTask = [&](const unsigned int i) {
+      const unsigned int start = this->nashgame->getPrimalLoc(i);
+      const unsigned int end = this->nashgame->getPrimalLoc(i + 1);
+      // The other countries' variables and the prices, as in the QP
+      arma::vec others = arma::join_cols(
+          start > 0 ? arma::vec(previous.subvec(0, start - 1)) : arma::vec{},
+          arma::vec(previous.subvec(end, othersEnd - 1)));
+      auto model = this->country_QP.at(i)->solveFixed(others);
+      solved.at(i) = model->get(GRB_IntAttr_Status) == GRB_OPTIMAL;
+      if (!solved.at(i))
+        return;
+      for (unsigned int j = 0; j < end - start; ++j)
+        x.at(start + j) =
+            model->getVarByName("y_" + to_string(j)).get(GRB_DoubleAttr_X);
+      // Gurobi's duals of <= constraints are nonpositive when minimizing
+      const unsigned int dual = this->nashgame->getDualLoc(i);
+      const std::unique_ptr<GRBConstr[]> constrs(model->getConstrs());
+      const unsigned int nCons = this->country_QP.at(i)->getb().n_rows;
+      for (unsigned int k = 0; k < nCons; ++k)
+        x.at(dual + k) = -constrs[k].get(GRB_DoubleAttr_Pi);
+    };
+    if (parallel) {
+      std::vector<std::future<void>> tasks;
+      for (unsigned int i = 0; i < this->nCountr; ++i)
+        tasks.push_back(std::async(std::launch::async, countryTask, i));
+      for (auto &task : tasks)
+        task.get();
+    } else {
+      for (unsigned int i = 0; i < this->nCountr; ++i)
+        countryTask(i);
+    }
+    if (std::find(solved.begin(), solved.end(), 0) != solved.end()) {
+      BOOST_LOG_TRIVIAL(info) << "Game::EPEC::decomposedNashEq: a country QP "
+                                 "was not solved";
+      return false;
+    }
+
+    // The coordinator: is the point an equilibrium, else update the prices
+    const arma::vec z = M * x + q;
+    double violation{0};
+    for (const auto &p : Compl) {
+      const double zi = z.at(p.first), xi = x.at(p.second);
+      violation = std::max({violation, -zi, -xi, std::abs(zi * xi)});
+    }
+    double residual{0};
+    for (unsigned int j = 0; j < nShadow; ++j)
+      residual = std::max(residual, std::abs(z.at(MCLoc + j)));
+    BOOST_LOG_TRIVIAL(debug) << "Game::EPEC::decomposedNashEq: round " << round
+                             << ", LCP violation " << violation
+                             << ", market clearing residual " << residual;
+    if (violation <= tol && residual <= tol &&
+        arma::abs(x - previous).max() <= tol) {
+      BOOST_LOG_TRIVIAL(info) << "Game::EPEC::decomposedNashEq: converged in "
+                              << round + 1 << " rounds";
+      this->sol_x = x;
+      this->sol_z = z;
+      return true;
+    }
+    if (nShadow == 0)
+      continue;
+    const double step = 1.0 / (round + 1);
+    for (unsigned int j = 0; j < nShadow; ++j)
+      x.at(MCLoc + j) =
+          std::max(0.0, previous.at(MCLoc + j) - step * z.at(MCLoc + j));
+    this->decompositionPrices = x.subvec(MCLoc, MCLoc + nShadow - 1);
+  }
+  return false;
+}
+
+void Game::EPEC::saveMasterStart()
+/**
+ * @brief Stores Game::EPEC::sol_x in a form that does not depend on the layout
+ * of the master LCP
+ * @details For each country, stores its own variables and, for each polyhedron
+ * in its inner approximation, the convex weight and the convex hull variables,
+ * keyed by the polyhedron's decimal encoding. Game::EPEC::setMasterStart maps
+ * them back onto the next master, after polyhedra have been added.
+ */
+{
+  this->startLeadFoll = std::vector<arma::vec>(this->nCountr);
+  this->startPolySol =
+      std::vector<std::map<unsigned long int, std::pair<double, arma::vec>>>(
+          this->nCountr);
+  for (unsigned int i = 0; i < this->nCountr; ++i) {
+    const auto &order = this->countries_LCP.at(i)->getPolyOrder();
+    const unsigned int nPoly = this->getNPoly_Lead(i);
+    const unsigned int nC = this->countries_LCP.at(i)->getNcol();
+    arma::vec &leadFoll = this->startLeadFoll.at(i);
+    leadFoll.zeros(nC);
+    for (unsigned int j = 0; j < nC; ++j)
+      leadFoll.at(j) = this->sol_x.at(this->getPosition_LeadFoll(i, j));
+    if (nPoly == 0 || order.size() != nPoly)
+      continue;
+    if (nPoly == 1) {
+      this->startPolySol.at(i)[order.front()] = {1, leadFoll};
+      continue;
+    }
+    for (unsigned int k = 0; k < nPoly; ++k) {
+      arma::vec polySol(nC, arma::fill::zeros);
+      for (unsigned int j = 0; j < nC; ++j)
+        polySol.at(j) =
+            this->sol_x.at(this->getPosition_LeadFollPoly(i, j, k));
+      this->startPolySol.at(i)[order.at(k)] = {
+          this->sol_x.at(this->getPosition_Probab(i, k)), polySol};
+    }
+  }
+}
+
+bool Game::EPEC::setMasterStart(
+    std::vector<GRBVar> &startVars, ///< [out] The variables given a start
+    std::vector<double> &startVals  ///< [out] Their start values
+)
+/**
+ * @brief Gives the solution saved by Game::EPEC::saveMasterStart to
+ * Game::EPEC::lcpmodel as a MIP start
+ * @details Polyhedra added since then get weight 0, so the previous equilibrium
+ * usually remains feasible. Complementarity binaries are set only for
+ * variables that are strictly positive, the rest of the start is left to
+ * Gurobi.
+ * @returns true if a start was set
+ */
+{
+  startVars.clear();
+  startVals.clear();
+  if (this->startLeadFoll.size() != this->nCountr)
+    return false;
+  std::vector<std::pair<unsigned int, double>> start{};
+  for (unsigned int i = 0; i < this->nCountr; ++i) {
+    const unsigned int nC = this->countries_LCP.at(i)->getNcol();
+    const arma::vec &leadFoll = this->startLeadFoll.at(i);
+    if (leadFoll.n_elem != nC)
+      return false;
+    for (unsigned int j = 0; j < nC; ++j)
+      start.push_back({this->getPosition_LeadFoll(i, j), leadFoll.at(j)});
+    const auto &order = this->countries_LCP.at(i)->getPolyOrder();
+    const unsigned int nPoly = this->getNPoly_Lead(i);
+    if (nPoly <= 1 || order.size() != nPoly)
+      continue;
+    for (unsigned int k = 0; k < nPoly; ++k) {
+      const auto known = this->startPolySol.at(i).find(order.at(k));
+      const bool isKnown = known != this->startPolySol.at(i).end();
+      start.push_back(
+          {this->getPosition_Probab(i, k), isKnown ? known->second.first : 0});
+      for (unsigned int j = 0; j < nC; ++j)
+        start.push_back({this->getPosition_LeadFollPoly(i, j, k),
+                         isKnown ? known->second.second.at(j) : 0});
+    }
+  }
+
+  std::map<unsigned int, unsigned int> complOfVar{};
+  for (const auto &p : this->lcp->getCompl())
+    complOfVar[p.second] = p.first;
+  for (const auto &s : start) {
+    GRBVar var = this->lcpmodel->getVarByName("x_" + to_string(s.first));
+    var.set(GRB_DoubleAttr_Start, s.second);
+    startVars.push_back(var);
+    startVals.push_back(s.second);
+    const auto pair = complOfVar.find(s.first);
+    if (s.second <= 1e-5 || pair == complOfVar.end())
+      continue;
+    // The variable is positive, hence its equation must be tight
+    const string eqn = to_string(pair->second);
+    if (this->Stats.AlgorithmParam.indicators) {
+      this->lcpmodel->getVarByName("u_" + eqn).set(GRB_DoubleAttr_Start, 1);
+      this->lcpmodel->getVarByName("v_" + eqn).set(GRB_DoubleAttr_Start, 0);
+    } else
+      this->lcpmodel->getVarByName("u_" + eqn).set(GRB_DoubleAttr_Start, 0);
+  }
+  return true;
+}
+
 bool Game::EPEC::warmstart(const arma::vec x) {
 
   if (x.size() < this->getnVarinEPEC()) {
@@ -2172,12 +3915,6 @@ void Game::EPEC::combinatorialPNE(
     const std::vector<long int> combination,
     const std::vector<std::set<unsigned long int>> &excludeList) {
 
-  if (this->Stats.AlgorithmParam.timeLimit > 0) {
-    // Checking the function hasn't been called from innerApproximation
-    if (this->Stats.numIteration <= 0) {
-      this->initTime = std::chrono::high_resolution_clock::now();
-    }
-  }
   if (combination.empty()) {
     std::vector<long int> start;
     for (unsigned int j = 0; j < this->nCountr; ++j)
@@ -2189,6 +3926,234 @@ void Game::EPEC::combinatorialPNE(
   return;
 }
 
+std::unique_ptr<Game::EPEC> Game::EPEC::makePortfolioCopy(GRBEnv *) const {
+  /**
+   * @brief Makes an independent copy of the instance, for
+   * Game::EPECalgorithm::portfolio
+   * @details To be implemented by the derived class. The copy must hold the
+   * same data as this object before Game::EPEC::finalize, and build all its
+   * models in the given environment. It is not finalized.
+   */
+  throw string("Error in Game::EPEC::makePortfolioCopy: the portfolio is not "
+               "supported by this EPEC");
+}
+
+std::vector<Game::EPECAlgorithmParams>
+Game::EPEC::getPortfolioConfigs() const {
+  /**
+   * @brief The configurations raced by Game::EPECalgorithm::portfolio
+   * @details Game::EPEC::portfolioConfigs if set. Otherwise, the
+   * configurations of runTests.sh: full enumeration, the inner approximation
+   * with three aggressiveness and polyhedra selection settings, and
+   * combinatorialPNE. All of them inherit the other parameters of this
+   * object.
+   */
+  if (!this->portfolioConfigs.empty())
+    return this->portfolioConfigs;
+
+  std::vector<EPECAlgorithmParams> configs;
+  EPECAlgorithmParams config = this->Stats.AlgorithmParam;
+  config.algorithm = EPECalgorithm::fullEnumeration;
+  configs.push_back(config);
+  config.algorithm = EPECalgorithm::innerApproximation;
+  const std::vector<std::pair<unsigned int, EPECAddPolyMethod>> inner{
+      {1, EPECAddPolyMethod::sequential},
+      {3, EPECAddPolyMethod::random},
+      {5, EPECAddPolyMethod::reverse_sequential}};
+  for (const auto &setting : inner) {
+    config.aggressiveness = setting.first;
+    config.addPolyMethod = setting.second;
+    configs.push_back(config);
+  }
+  config.algorithm = EPECalgorithm::combinatorialPNE;
+  configs.push_back(config);
+  return configs;
+}
+
+void Game::EPEC::adoptPortfolioRun(Game::EPEC &run, bool solution) {
+  /**
+   * @brief Takes over the outcome of a run of Game::EPECalgorithm::portfolio
+   * @details If @p solution, the approximations, the master LCP, the solution
+   * and the statistics of @p run replace the ones of this object, whose
+   * locations are updated accordingly. The parameters of this object are
+   * kept. In any case, the incumbent of @p run is taken over.
+   * The models taken over live in the environments of @p run, which the
+   * caller must keep alive.
+   */
+  const EPECAlgorithmParams params = this->Stats.AlgorithmParam;
+  if (solution) {
+    this->countries_LCP.swap(run.countries_LCP);
+    this->country_QP.swap(run.country_QP);
+    this->LeadObjec_ConvexHull.swap(run.LeadObjec_ConvexHull);
+    this->nashgame.swap(run.nashgame);
+    this->lcp.swap(run.lcp);
+    this->lcpmodel.swap(run.lcpmodel);
+    this->lcpmodel_base.swap(run.lcpmodel_base);
+    // The deadline of run goes away with it
+    for (auto &country : this->countries_LCP)
+      country->deadline = &this->deadline;
+    for (auto &qp : this->country_QP)
+      if (qp)
+        qp->deadline = &this->deadline;
+    if (this->lcp)
+      this->lcp->deadline = &this->deadline;
+
+    this->convexHullVariables = run.convexHullVariables;
+    this->updateLocs();
+    this->computeLeaderLocations(this->n_MCVar);
+    this->sol_x = run.sol_x;
+    this->sol_z = run.sol_z;
+    this->nashEq = run.nashEq;
+    this->masterPoolSols = run.masterPoolSols;
+    this->startLeadFoll = run.startLeadFoll;
+    this->startPolySol = run.startPolySol;
+    this->Stats = run.Stats;
+  } else
+    this->Stats.incumbentRegret = run.Stats.incumbentRegret;
+  this->Stats.AlgorithmParam = params;
+
+  std::lock_guard<std::mutex> lock(this->incumbentMutex);
+  this->incumbentLeadFoll = run.incumbentLeadFoll;
+  this->incumbentMC = run.incumbentMC;
+}
+
+void Game::EPEC::portfolioNash() {
+  /**
+   * @brief Races the configurations of Game::EPEC::getPortfolioConfigs
+   * @details Each configuration runs Game::EPEC::findNashEq on its own copy
+   * of the instance (see Game::EPEC::makePortfolioCopy), in its own Gurobi
+   * environment and with an equal share of
+   * Game::EPECAlgorithmParams::threads. The first run that finds an
+   * equilibrium, or proves that there is none, cancels the others through
+   * their Game::Deadline, and this object takes over its outcome. Only the
+   * runs that search the same equilibria as this object prove that there is
+   * none: a run of Game::EPECalgorithm::combinatorialPNE, or one looking for
+   * pure equilibria only, does not when Game::EPECAlgorithmParams::pureNE is
+   * not set here. If no run succeeds, the best incumbent among the runs is
+   * kept.
+   */
+  std::vector<EPECAlgorithmParams> configs = this->getPortfolioConfigs();
+  for (const auto &config : configs)
+    if (config.algorithm == EPECalgorithm::portfolio)
+      throw string("Error in Game::EPEC::portfolioNash: a portfolio cannot "
+                   "race another portfolio");
+  if (configs.empty())
+    throw string("Error in Game::EPEC::portfolioNash: empty portfolio");
+  if (this->deadline.expired()) {
+    this->Stats.status = Game::EPECsolveStatus::timeLimit;
+    return;
+  }
+
+  const unsigned int nRuns = configs.size();
+  const unsigned int threads = this->Stats.AlgorithmParam.threads > 0
+                                   ? this->Stats.AlgorithmParam.threads
+                                   : std::thread::hardware_concurrency();
+  const unsigned int share = std::max(1u, threads / nRuns);
+  BOOST_LOG_TRIVIAL(info) << "Game::EPEC::portfolioNash: racing " << nRuns
+                          << " configurations with " << share
+                          << " thread(s) each";
+
+  // Gurobi environments are not thread safe: everything is built here
+  std::vector<std::unique_ptr<GRBEnv>> envs;
+  std::vector<std::unique_ptr<Game::EPEC>> runs;
+  for (unsigned int k = 0; k < nRuns; ++k) {
+    envs.push_back(std::unique_ptr<GRBEnv>(new GRBEnv()));
+    envs.back()->set(GRB_IntParam_Threads, share);
+    envs.back()->set(GRB_IntParam_OutputFlag, 0);
+    runs.push_back(this->makePortfolioCopy(envs.back().get()));
+    runs.back()->racing = true;
+    EPECAlgorithmParams &param = runs.back()->Stats.AlgorithmParam;
+    param = configs.at(k);
+    param.threads = share;
+    param.timeLimit =
+        this->deadline.isActive() ? this->deadline.remaining() : -1;
+    runs.back()->finalize();
+  }
+
+  // Whether the outcome nashEqNotFound of each run settles the instance
+  std::vector<char> exhaustive(nRuns);
+  for (unsigned int k = 0; k < nRuns; ++k)
+    exhaustive.at(k) = this->Stats.AlgorithmParam.pureNE ||
+                       (!configs.at(k).pureNE &&
+                        configs.at(k).algorithm !=
+                            EPECalgorithm::combinatorialPNE);
+
+  std::mutex winnerMutex;
+  int winner{-1};
+  auto race = [&](const unsigned int k) {
+    auto &run = *runs.at(k);
+    try {
+      run.findNashEq();
+    } catch (string &e) {
+      BOOST_LOG_TRIVIAL(warning) << "Game::EPEC::portfolioNash: configuration "
+                                 << k << " failed: " << e;
+      return;
+    } catch (GRBException &e) {
+      BOOST_LOG_TRIVIAL(warning)
+          << "Game::EPEC::portfolioNash: configuration " << k
+          << " failed: " << e.getErrorCode() << ": " << e.getMessage();
+      return;
+    } catch (exception &e) {
+      BOOST_LOG_TRIVIAL(warning) << "Game::EPEC::portfolioNash: configuration "
+                                 << k << " failed: " << e.what();
+      return;
+    }
+    const bool settled =
+        (run.Stats.status == Game::EPECsolveStatus::nashEqFound &&
+         (!this->Stats.AlgorithmParam.pureNE || run.Stats.pureNE)) ||
+        (run.Stats.status == Game::EPECsolveStatus::nashEqNotFound &&
+         exhaustive.at(k));
+    if (!settled)
+      return;
+    std::lock_guard<std::mutex> lock(winnerMutex);
+    if (winner >= 0)
+      return;
+    winner = k;
+    for (unsigned int j = 0; j < nRuns; ++j)
+      if (j != k)
+        runs.at(j)->deadline.cancel();
+  };
+  std::vector<std::future<void>> racers;
+  for (unsigned int k = 0; k < nRuns; ++k)
+    racers.push_back(std::async(std::launch::async, race, k));
+  for (auto &racer : racers)
+    racer.get();
+
+  if (winner >= 0) {
+    BOOST_LOG_TRIVIAL(info)
+        << "Game::EPEC::portfolioNash: configuration " << winner << " ("
+        << to_string(configs.at(winner).algorithm) << ") won";
+    auto &run = *runs.at(winner);
+    this->adoptPortfolioRun(run, true);
+    for (auto &env : run.countryEnvs)
+      envs.push_back(std::move(env));
+  } else {
+    int best{-1};
+    double bestRegret{GRB_INFINITY};
+    bool timedOut{false};
+    for (unsigned int k = 0; k < nRuns; ++k) {
+      timedOut = timedOut || runs.at(k)->Stats.status ==
+                                 Game::EPECsolveStatus::timeLimit;
+      const double regret = runs.at(k)->incumbentMaxRegret();
+      if (regret < bestRegret) {
+        best = k;
+        bestRegret = regret;
+      }
+    }
+    if (best >= 0)
+      this->adoptPortfolioRun(*runs.at(best), false);
+    this->Stats.status = timedOut ? Game::EPECsolveStatus::timeLimit
+                                  : Game::EPECsolveStatus::numerical;
+  }
+  this->Stats.portfolioWinner = winner;
+  // The models of the runs go first. The environments of a winner replace
+  // the previous ones, whose models went away with the runs. Otherwise, the
+  // models of this object still live in the previous environments
+  runs.clear();
+  if (winner >= 0)
+    this->portfolioEnvs = std::move(envs);
+}
+
 void Game::EPEC::findNashEq() {
   /**
    * @brief Computes Nash equilibrium using the algorithm set in
@@ -2209,25 +4174,56 @@ void Game::EPEC::findNashEq() {
            "already found. Calling this findNashEq might lead to errors!";
     this->resetLCP();
   }
+  {
+    std::lock_guard<std::mutex> lock(this->incumbentMutex);
+    this->incumbentLeadFoll.clear();
+    this->incumbentMC.reset();
+    this->Stats.incumbentRegret.clear();
+  }
+  this->Stats.approximate = false;
+  // Every solver call from now on is limited to the time left
+  this->deadline.set(this->Stats.AlgorithmParam.timeLimit);
 
-  // Choosing the appropriate algorithm
-  switch (this->Stats.AlgorithmParam.algorithm) {
+  // Countries that do not interact need no master LCP
+  if (this->decoupledNash()) {
+    final_msg << "Countries solved independently. ";
+  } else {
+    // Choosing the appropriate algorithm
+    switch (this->Stats.AlgorithmParam.algorithm) {
 
-  case Game::EPECalgorithm::innerApproximation:
-    this->iterativeNash();
-    final_msg << "Inner approximation algorithm completed. ";
-    break;
+    case Game::EPECalgorithm::innerApproximation:
+      this->iterativeNash();
+      final_msg << "Inner approximation algorithm completed. ";
+      break;
 
-  case Game::EPECalgorithm::combinatorialPNE:
-    this->combinatorialPNE();
-    final_msg << "CombinatorialPNE algorithm completed. ";
-    break;
+    case Game::EPECalgorithm::combinatorialPNE:
+      this->combinatorialPNE();
+      final_msg << "CombinatorialPNE algorithm completed. ";
+      break;
 
-  case Game::EPECalgorithm::fullEnumeration:
-    this->fullEnumerationNash();
-    final_msg << "Full enumeration algorithm completed. ";
-    break;
+    case Game::EPECalgorithm::fullEnumeration:
+      this->fullEnumerationNash();
+      final_msg << "Full enumeration algorithm completed. ";
+      break;
+
+    case Game::EPECalgorithm::outerApproximation:
+      this->outerApproximationNash();
+      final_msg << "Outer approximation algorithm completed. ";
+      break;
+
+    case Game::EPECalgorithm::bestResponseDynamics:
+      this->bestResponseDynamicsNash();
+      final_msg << "Best-response dynamics completed. ";
+      break;
+
+    case Game::EPECalgorithm::portfolio:
+      this->portfolioNash();
+      final_msg << "Portfolio completed. ";
+      break;
+    }
   }
+  // The tolerance continuation is over, whatever the outcome
+  this->continuationFactor = 1;
   // Handing EPECStatistics object to track performance of algorithm
   if (this->lcpmodel) {
     this->Stats.numVar = this->lcpmodel->get(GRB_IntAttr_NumVars);
@@ -2256,9 +4252,109 @@ void Game::EPEC::findNashEq() {
   }
   BOOST_LOG_TRIVIAL(info) << "Game::EPEC::findNashEq: " << final_msg.str();
 }
+bool Game::EPEC::decoupledNash() {
+  /**
+   * @brief Solves the EPEC directly when its countries do not interact
+   * @details If no leader objective depends on the other countries' variables
+   * (Game::QP_objective::C is zero) and the market clearing constraints are
+   * void, as with a single country, each country solves its own MPEC, and the
+   * optimal solutions form a pure Nash equilibrium. Each MPEC is then solved
+   * once with Game::LCP::MPECasMIQP (see Game::EPEC::Respond), instead of
+   * building convex hulls and solving master LCPs.
+   *
+   * The solutions are mapped back into Game::EPEC::sol_x and
+   * Game::EPEC::sol_z through the master LCP of the polyhedra containing
+   * them, which is built but not solved: the primal variables and the duals
+   * of each country's QP over its polyhedron come from
+   * Game::QP_Param::solveFixed.
+   * @returns false if the countries interact, in which case nothing is done
+   */
+  arma::sp_mat MC(0, this->nVarinEPEC);
+  arma::vec MCRHS;
+  this->make_MC_cons(MC, MCRHS);
+  if (MC.n_nonzero > 0)
+    return false;
+  for (const auto &objective : this->LeadObjec)
+    if (objective->C.n_nonzero > 0)
+      return false;
+  BOOST_LOG_TRIVIAL(info) << "Game::EPEC::decoupledNash: the countries do not "
+                             "interact. Solving each MPEC directly.";
+
+  this->Stats.numIteration = 1;
+  this->sol_x.zeros(this->nVarinEPEC);
+  for (unsigned int i = 0; i < this->nCountr; ++i) {
+    auto model = this->Respond(i, this->sol_x);
+    const int status = model->get(GRB_IntAttr_Status);
+    this->Stats.wallClockTime += model->get(GRB_DoubleAttr_Runtime);
+    if (status == GRB_INFEASIBLE) {
+      BOOST_LOG_TRIVIAL(info) << "Game::EPEC::decoupledNash: country " << i
+                              << " has no feasible strategy";
+      this->Stats.status = Game::EPECsolveStatus::nashEqNotFound;
+      return true;
+    }
+    if (status != GRB_OPTIMAL) {
+      BOOST_LOG_TRIVIAL(warning) << "Game::EPEC::decoupledNash: MPEC of "
+                                    "country "
+                                 << i << " not solved (GRB_STATUS=" << status
+                                 << ")";
+      this->Stats.status = status == GRB_TIME_LIMIT || status == GRB_INTERRUPTED
+                               ? Game::EPECsolveStatus::timeLimit
+                               : Game::EPECsolveStatus::numerical;
+      return true;
+    }
+    const unsigned int nC = this->countries_LCP.at(i)->getNcol();
+    arma::vec y(nC, arma::fill::zeros);
+    for (unsigned int j = 0; j < nC; ++j)
+      y.at(j) = model->getVarByName("x_" + to_string(j)).get(GRB_DoubleAttr_X);
+    auto &LCP_i = this->countries_LCP.at(i);
+    LCP_i->clearPolyhedra();
+    if (!LCP_i->addThePoly(LCP_i->polyFromX(y))) {
+      BOOST_LOG_TRIVIAL(warning) << "Game::EPEC::decoupledNash: the polyhedron "
+                                    "of the MPEC solution of country "
+                                 << i << " is infeasible";
+      this->Stats.status = Game::EPECsolveStatus::numerical;
+      return true;
+    }
+  }
+
+  // The master LCP fixes the layout of sol_x
+  this->make_country_QP();
+  this->make_country_LCP();
+  this->sol_x.zeros(this->lcp->getNcol());
+  for (unsigned int i = 0; i < this->nCountr; ++i) {
+    arma::vec solOther;
+    this->get_x_minus_i(this->sol_x, i, solOther);
+    auto model = this->country_QP.at(i)->solveFixed(solOther);
+    if (model->get(GRB_IntAttr_Status) != GRB_OPTIMAL) {
+      this->Stats.status = Game::EPECsolveStatus::numerical;
+      return true;
+    }
+    const unsigned int primal = this->nashgame->getPrimalLoc(i);
+    for (unsigned int j = 0; j < this->country_QP.at(i)->getNy(); ++j)
+      this->sol_x.at(primal + j) =
+          model->getVarByName("y_" + to_string(j)).get(GRB_DoubleAttr_X);
+    // Gurobi's duals of <= constraints are nonpositive when minimizing
+    const unsigned int dual = this->nashgame->getDualLoc(i);
+    const std::unique_ptr<GRBConstr[]> constrs(model->getConstrs());
+    const unsigned int nCons = this->country_QP.at(i)->getb().n_rows;
+    for (unsigned int k = 0; k < nCons; ++k)
+      this->sol_x.at(dual + k) = -constrs[k].get(GRB_DoubleAttr_Pi);
+  }
+  this->sol_z = this->lcp->getM() * this->sol_x + this->lcp->getq();
+  this->nashEq = true;
+  this->Stats.status = Game::EPECsolveStatus::nashEqFound;
+  this->Stats.pureNE = true;
+  return true;
+}
+
 void Game::EPEC::fullEnumerationNash() {
   for (unsigned int i = 0; i < this->nCountr; ++i)
     this->countries_LCP.at(i)->EnumerateAll(true);
+  if (this->deadline.expired()) {
+    // A partial enumeration proves nothing
+    this->Stats.status = Game::EPECsolveStatus::timeLimit;
+    return;
+  }
   this->make_country_QP();
   BOOST_LOG_TRIVIAL(trace)
       << "Game::EPEC::findNashEq: Starting fullEnumeration search";
@@ -2266,7 +4362,7 @@ void Game::EPEC::fullEnumerationNash() {
                            << "Time limit: "
                            << this->Stats.AlgorithmParam.timeLimit;
   this->computeNashEq(this->Stats.AlgorithmParam.pureNE,
-                      this->Stats.AlgorithmParam.timeLimit);
+                      this->deadline.remaining());
   BOOST_LOG_TRIVIAL(debug) << "EPEC::fullEnumerationNash: "
                            << "computeNashEq completed "
                            << std::to_string(this->Stats.status);
@@ -2280,6 +4376,454 @@ void Game::EPEC::fullEnumerationNash() {
                            << std::to_string(this->Stats.status);
 }
 
+void Game::EPEC::outerApproximationNash() {
+  /**
+   * @brief Computes a Nash equilibrium on outer approximations of the
+   * countries' feasible regions, branching on their complementarities
+   * @details Each country starts from its relaxed LCP, namely a single
+   * polyhedron where no complementarity is fixed (see Game::LCP::addOuterPoly).
+   * Then, at each iteration:
+   *  - The master LCP is solved on the convex hull of each country's
+   * polyhedra, which contains the convex hull of its feasible region.
+   *  - In each polyhedron played with positive probability, the strategy of
+   * the country is checked against its complementarities. If none is
+   * violated, every country plays a mix of feasible strategies. Since each
+   * feasible deviation is in the outer approximation, this is a Nash
+   * equilibrium, which is still certified by Game::EPEC::isSolved.
+   *  - Otherwise, the violations are ranked by their size times the
+   * probability of the polyhedron. Best first, up to
+   * Game::EPECAlgorithmParams::aggressiveness polyhedra are branched on their
+   * most violated complementarity (see Game::LCP::branchOuterPoly). Children
+   * with no solution are pruned.
+   *  - If Game::EPECAlgorithmParams::disjunctiveCuts is positive, a
+   * lift-and-project cut is first sought for each of them (see
+   * Game::LCP::addDisjunctiveCut). The cuts go to the pool of the country,
+   * shared by all its polyhedra in later iterations, and a polyhedron whose
+   * point is cut off is not branched. Once the pool is full, the polyhedra
+   * are only branched. The pool starts empty at each call, so that
+   * Game::EPECStatistics::cutPoolSize counts the cuts of this call only.
+   *  - If the master has no equilibrium, the polyhedra with the most relaxed
+   * complementarities are branched first. Once every complementarity is
+   * fixed, the polyhedra are those of Game::EPEC::fullEnumerationNash that
+   * were not pruned, and no equilibrium exists.
+   *
+   * Only the polyhedra played by the master are refined, so that the
+   * equilibrium, or the proof that there is none, does not require to
+   * enumerate the @f$2^n@f$ polyhedra of each country.
+   */
+  this->Stats.numIteration = 0;
+  this->Stats.cutPoolSize = std::vector<unsigned int>(this->nCountr, 0);
+  for (unsigned int i = 0; i < this->nCountr; ++i) {
+    auto &LCP_i = this->countries_LCP.at(i);
+    LCP_i->clearPolyhedra();
+    LCP_i->clearCuts();
+    if (!LCP_i->addOuterPoly(std::vector<short int>(LCP_i->getNrow(), 0))) {
+      BOOST_LOG_TRIVIAL(info) << "Game::EPEC::outerApproximationNash: country "
+                              << i << " has no feasible strategy";
+      this->Stats.status = Game::EPECsolveStatus::nashEqNotFound;
+      return;
+    }
+  }
+  const unsigned int maxBranches =
+      std::max(1u, this->Stats.AlgorithmParam.aggressiveness);
+  // Score, country, polyhedron and complementarity of a branching
+  typedef std::tuple<double, unsigned int, unsigned int, unsigned int> branch;
+
+  while (true) {
+    if (Game::EPEC::stopRequested() || this->deadline.expired()) {
+      BOOST_LOG_TRIVIAL(warning) << "Game::EPEC::outerApproximationNash: stop "
+                                    "requested or out of time.";
+      this->Stats.status = Game::EPECsolveStatus::timeLimit;
+      return;
+    }
+    ++this->Stats.numIteration;
+    BOOST_LOG_TRIVIAL(info) << "Game::EPEC::outerApproximationNash: Iteration "
+                            << to_string(this->Stats.numIteration);
+    this->make_country_QP();
+    const bool found = this->computeNashEq(false, this->deadline.remaining());
+    if (this->deadline.expired()) {
+      this->Stats.status = Game::EPECsolveStatus::timeLimit;
+      return;
+    }
+
+    std::priority_queue<branch> candidates{};
+    // The strategy of each country in each violating polyhedron
+    std::map<std::pair<unsigned int, unsigned int>, arma::vec> points{};
+    if (found) {
+      for (unsigned int i = 0; i < this->nCountr; ++i) {
+        const auto &LCP_i = this->countries_LCP.at(i);
+        const unsigned int nPoly = this->getNPoly_Lead(i);
+        const unsigned int nC = LCP_i->getNcol();
+        for (unsigned int k = 0; k < nPoly; ++k) {
+          double weight{1};
+          arma::vec point(nC, arma::fill::zeros);
+          if (nPoly == 1) {
+            for (unsigned int j = 0; j < nC; ++j)
+              point.at(j) = this->sol_x.at(this->getPosition_LeadFoll(i, j));
+          } else {
+            weight = this->sol_x.at(this->getPosition_Probab(i, k));
+            // Polyhedra that are not played are not refined
+            if (weight <= 1e-5)
+              continue;
+            for (unsigned int j = 0; j < nC; ++j)
+              point.at(j) =
+                  this->sol_x.at(this->getPosition_LeadFollPoly(i, j, k)) /
+                  weight;
+          }
+          double violation{0};
+          const long int pair = LCP_i->mostViolatedCompl(point, violation);
+          if (pair >= 0) {
+            candidates.push(branch{weight * violation, i, k, pair});
+            points[{i, k}] = point;
+          }
+        }
+      }
+      if (candidates.empty()) {
+        unsigned int deviatedCountry{0};
+        arma::vec countryDeviation{};
+        if (this->isSolved(&deviatedCountry, &countryDeviation,
+                           this->currentSolvedTol())) {
+          this->Stats.status = Game::EPECsolveStatus::nashEqFound;
+          this->Stats.pureNE = this->isPureStrategy();
+          return;
+        }
+        BOOST_LOG_TRIVIAL(error)
+            << "Game::EPEC::outerApproximationNash: country "
+            << deviatedCountry
+            << " deviates from a feasible equilibrium of the outer "
+               "approximation. This might be due to numerical issues";
+        this->Stats.status = Game::EPECsolveStatus::numerical;
+        return;
+      }
+    } else {
+      for (unsigned int i = 0; i < this->nCountr; ++i) {
+        const auto &polys = this->countries_LCP.at(i)->getOuterPolys();
+        for (unsigned int k = 0; k < polys.size(); ++k) {
+          const auto &fix = polys.at(k);
+          const auto relaxed = std::count(fix.begin(), fix.end(), 0);
+          if (relaxed > 0)
+            candidates.push(branch{
+                static_cast<double>(relaxed), i, k,
+                std::find(fix.begin(), fix.end(), 0) - fix.begin()});
+        }
+      }
+      if (candidates.empty()) {
+        BOOST_LOG_TRIVIAL(info) << "Game::EPEC::outerApproximationNash: no "
+                                   "equilibrium on the exact hulls";
+        this->Stats.status = Game::EPECsolveStatus::nashEqNotFound;
+        return;
+      }
+    }
+
+    // Best first, at most once per polyhedron. Then the last polyhedra go
+    // first, so that the positions of the others do not change
+    std::vector<branch> chosen{};
+    std::set<std::pair<unsigned int, unsigned int>> branched{};
+    while (!candidates.empty() && chosen.size() < maxBranches) {
+      const branch top = candidates.top();
+      candidates.pop();
+      if (branched.insert({std::get<1>(top), std::get<2>(top)}).second)
+        chosen.push_back(top);
+    }
+    std::sort(chosen.begin(), chosen.end(),
+              [](const branch &a, const branch &b) {
+                return std::make_pair(std::get<1>(a), std::get<2>(a)) >
+                       std::make_pair(std::get<1>(b), std::get<2>(b));
+              });
+    const unsigned int maxCuts = this->Stats.AlgorithmParam.disjunctiveCuts;
+    for (auto c = chosen.begin(); c != chosen.end();) {
+      const auto point = points.find({std::get<1>(*c), std::get<2>(*c)});
+      auto &LCP_i = this->countries_LCP.at(std::get<1>(*c));
+      if (point != points.end() && LCP_i->getNumCuts() < maxCuts &&
+          LCP_i->addDisjunctiveCut(point->second, std::get<3>(*c))) {
+        this->Stats.cutPoolSize.at(std::get<1>(*c)) = LCP_i->getNumCuts();
+        c = chosen.erase(c);
+      } else
+        ++c;
+    }
+    for (const auto &c : chosen) {
+      const unsigned int i = std::get<1>(c);
+      const unsigned int added = this->countries_LCP.at(i)->branchOuterPoly(
+          std::get<2>(c), std::get<3>(c));
+      BOOST_LOG_TRIVIAL(debug)
+          << "Game::EPEC::outerApproximationNash: country " << i
+          << ", polyhedron " << std::get<2>(c) << " branched on "
+          << std::get<3>(c) << " into " << added << " children";
+    }
+    for (unsigned int i = 0; i < this->nCountr; ++i)
+      if (this->getNPoly_Lead(i) == 0) {
+        BOOST_LOG_TRIVIAL(info)
+            << "Game::EPEC::outerApproximationNash: country " << i
+            << " has no feasible strategy";
+        this->Stats.status = Game::EPECsolveStatus::nashEqNotFound;
+        return;
+      }
+  }
+}
+
+void Game::EPEC::dynamicsResponses(
+    const std::vector<unsigned int> &players, ///< Countries that respond
+    std::vector<double> &vals, ///< [out] Optimal value of each response,
+                               ///< GRB_INFINITY if not solved to optimality
+    std::vector<double> &bounds, ///< [out] Dual bound of each response,
+                                 ///< -GRB_INFINITY if not solved
+    std::vector<unsigned long int>
+        &polys,       ///< [out] Polyhedron of each response
+    bool &infeasible ///< [out] True if some country has no feasible strategy
+) {
+  /**
+   * @brief Best responses of @p players to Game::EPEC::sol_x, for
+   * Game::EPEC::bestResponseDynamicsNash
+   * @details With Game::EPECDynamics::jacobi, the responses are computed
+   * concurrently by at most Game::EPECAlgorithmParams::threads workers (the
+   * hardware concurrency if 0). Each worker has its own Gurobi environment,
+   * and makes the response MIQPs on its own copies of the countries' Game::LCP
+   * (see Game::EPEC::Respond). Only the entries of @p vals, @p bounds and
+   * @p polys indexed by @p players are written.
+   */
+  infeasible = false;
+  std::vector<int> statuses(this->nCountr, GRB_LOADED);
+  auto respond = [&](const unsigned int i, Game::LCP *lcp) {
+    auto model = this->Respond(i, this->sol_x, true, lcp);
+    statuses.at(i) = model->get(GRB_IntAttr_Status);
+    vals.at(i) = GRB_INFINITY;
+    bounds.at(i) = -GRB_INFINITY;
+    if (statuses.at(i) != GRB_OPTIMAL)
+      return;
+    const unsigned int nC = lcp->getNcol();
+    arma::vec y(nC, arma::fill::zeros);
+    for (unsigned int j = 0; j < nC; ++j)
+      y.at(j) = model->getVarByName("x_" + to_string(j)).get(GRB_DoubleAttr_X);
+    vals.at(i) = model->get(GRB_DoubleAttr_ObjVal);
+    bounds.at(i) = responseBound(*model);
+    polys.at(i) = lcp->polyFromX(y);
+  };
+
+  const bool concurrent =
+      this->Stats.AlgorithmParam.dynamics == Game::EPECDynamics::jacobi &&
+      players.size() > 1;
+  if (!concurrent) {
+    for (const unsigned int i : players)
+      respond(i, this->countries_LCP.at(i).get());
+  } else {
+    const unsigned int threads =
+        this->Stats.AlgorithmParam.threads > 0
+            ? this->Stats.AlgorithmParam.threads
+            : std::max(1u, std::thread::hardware_concurrency());
+    const unsigned int nWorkers =
+        std::min(threads, static_cast<unsigned int>(players.size()));
+    std::atomic<unsigned int> next{0};
+    auto worker = [&]() {
+      GRBEnv workerEnv;
+      workerEnv.set(GRB_IntParam_Threads, 1);
+      workerEnv.set(GRB_IntParam_OutputFlag, 0);
+      for (unsigned int k = next++; k < players.size(); k = next++) {
+        const unsigned int i = players.at(k);
+        Game::LCP workerLCP(&workerEnv, *this->countries_LL.at(i).get());
+        workerLCP.deadline = &this->deadline;
+        respond(i, &workerLCP);
+      }
+    };
+    std::vector<std::future<void>> workers;
+    for (unsigned int w = 0; w < nWorkers; ++w)
+      workers.push_back(std::async(std::launch::async, worker));
+    try {
+      for (auto &w : workers)
+        w.get();
+    } catch (string &e) {
+      cerr << "String in Game::EPEC::dynamicsResponses : " << e << '\n';
+      throw;
+    } catch (GRBException &e) {
+      cerr << "GRBException in Game::EPEC::dynamicsResponses : "
+           << e.getErrorCode() << ": " << e.getMessage() << '\n';
+      throw;
+    } catch (exception &e) {
+      cerr << "Exception in Game::EPEC::dynamicsResponses : " << e.what()
+           << '\n';
+      throw;
+    }
+  }
+  for (const unsigned int i : players) {
+    if (statuses.at(i) == GRB_INFEASIBLE) {
+      BOOST_LOG_TRIVIAL(info) << "Game::EPEC::dynamicsResponses: country " << i
+                              << " has no feasible strategy";
+      infeasible = true;
+    }
+  }
+}
+
+void Game::EPEC::bestResponseDynamicsNash() {
+  /**
+   * @brief Computes a pure Nash equilibrium with best-response dynamics
+   * @details A profile assigns one polyhedron to each country. The master LCP
+   * restricted to the profile is solved as in Game::EPEC::iterativeNash,
+   * which also yields the market clearing variables. Then, the countries best
+   * respond to its equilibrium (see Game::EPEC::Respond), and the improving
+   * ones move to the polyhedron of their response:
+   * - with Game::EPECDynamics::gaussSeidel, the first improving country, in
+   * round-robin order from the last one that moved;
+   * - with Game::EPECDynamics::jacobi, all of them, the responses being
+   * computed concurrently (see Game::EPEC::dynamicsResponses).
+   *
+   * When no country improves, the equilibrium of the restricted master is a
+   * pure Nash equilibrium. The initial profile is made of the best responses
+   * to Game::EPEC::sol_x.
+   *
+   * The profiles are hashed, and a profile seen before proves a cycle. On a
+   * cycle, when the restricted master has no equilibrium, or after
+   * Game::EPECAlgorithmParams::dynamicsRounds profiles, every polyhedron
+   * visited so far is added to the countries' Game::LCP and
+   * Game::EPEC::iterativeNash takes over from there. It does as well when a
+   * country improves within its own polyhedron, since the restricted master
+   * then failed numerically and the profile cannot move.
+   */
+  if (!this->warmStarted)
+    this->sol_x.zeros(this->nVarinEPEC);
+  this->Stats.numIteration = 0;
+  const unsigned int maxRounds = this->Stats.AlgorithmParam.dynamicsRounds;
+  const bool jacobi =
+      this->Stats.AlgorithmParam.dynamics == Game::EPECDynamics::jacobi;
+  std::vector<unsigned int> all(this->nCountr);
+  std::iota(all.begin(), all.end(), 0);
+  std::vector<double> vals(this->nCountr, GRB_INFINITY);
+  std::vector<double> bounds(this->nCountr, -GRB_INFINITY);
+  std::vector<unsigned long int> profile(this->nCountr, 0);
+  std::vector<std::set<unsigned long int>> visited(this->nCountr);
+  std::unordered_set<std::vector<unsigned long int>,
+                     boost::hash<std::vector<unsigned long int>>>
+      seen{};
+
+  auto handOver = [&](const std::string &reason) {
+    BOOST_LOG_TRIVIAL(info) << "Game::EPEC::bestResponseDynamicsNash: "
+                            << reason
+                            << ". Handing over to the inner approximation.";
+    for (unsigned int i = 0; i < this->nCountr; ++i) {
+      this->countries_LCP.at(i)->clearPolyhedra();
+      for (const auto poly : visited.at(i))
+        this->countries_LCP.at(i)->addThePoly(poly);
+    }
+    this->iterativeNash();
+  };
+
+  bool infeasible{false};
+  this->dynamicsResponses(all, vals, bounds, profile, infeasible);
+  if (infeasible) {
+    this->Stats.status = Game::EPECsolveStatus::nashEqNotFound;
+    return;
+  }
+  if (std::find(vals.begin(), vals.end(), GRB_INFINITY) != vals.end()) {
+    if (this->deadline.expired())
+      this->Stats.status = Game::EPECsolveStatus::timeLimit;
+    else
+      handOver("an initial best response was not solved");
+    return;
+  }
+  // Next country to respond with Game::EPECDynamics::gaussSeidel
+  unsigned int next{0};
+  while (true) {
+    if (Game::EPEC::stopRequested() || this->deadline.expired()) {
+      BOOST_LOG_TRIVIAL(warning) << "Game::EPEC::bestResponseDynamicsNash: "
+                                    "stop requested or out of time.";
+      this->Stats.status = Game::EPECsolveStatus::timeLimit;
+      return;
+    }
+    if (!seen.insert(profile).second) {
+      handOver("cycle detected");
+      return;
+    }
+    if (maxRounds > 0 &&
+        this->Stats.numIteration >= static_cast<int>(maxRounds)) {
+      handOver("round limit reached");
+      return;
+    }
+    ++this->Stats.numIteration;
+    BOOST_LOG_TRIVIAL(info) << "Game::EPEC::bestResponseDynamicsNash: Round "
+                            << to_string(this->Stats.numIteration);
+
+    bool added{true};
+    for (unsigned int i = 0; i < this->nCountr; ++i) {
+      visited.at(i).insert(profile.at(i));
+      this->countries_LCP.at(i)->clearPolyhedra();
+      added = this->countries_LCP.at(i)->addThePoly(profile.at(i)) && added;
+    }
+    if (!added) {
+      handOver("a polyhedron of the profile is infeasible");
+      return;
+    }
+    this->make_country_QP();
+    if (!this->computeNashEq(false, this->deadline.remaining())) {
+      if (this->deadline.expired())
+        this->Stats.status = Game::EPECsolveStatus::timeLimit;
+      else
+        handOver("the restricted master has no equilibrium");
+      return;
+    }
+
+    const double tol = this->currentSolvedTol();
+    const arma::vec objvals =
+        this->nashgame->ComputeQPObjvals(this->sol_x, true);
+    std::vector<double> regrets(this->nCountr, GRB_INFINITY);
+    std::vector<unsigned long int> polys(profile);
+    std::vector<unsigned int> movers{};
+    bool stuck{false};
+    // Gauss-Seidel asks one country at a time, Jacobi all of them at once
+    for (unsigned int k = 0; k < this->nCountr && movers.empty(); ++k) {
+      const std::vector<unsigned int> players =
+          jacobi ? all
+                 : std::vector<unsigned int>{(next + k) % this->nCountr};
+      this->dynamicsResponses(players, vals, bounds, polys, infeasible);
+      if (infeasible) {
+        this->Stats.status = Game::EPECsolveStatus::nashEqNotFound;
+        return;
+      }
+      for (const unsigned int i : players) {
+        if (vals.at(i) == GRB_INFINITY) {
+          if (this->deadline.expired())
+            this->Stats.status = Game::EPECsolveStatus::timeLimit;
+          else
+            handOver("a best response was not solved");
+          return;
+        }
+        regrets.at(i) = std::max(0.0, objvals.at(i) - bounds.at(i));
+        if (objvals.at(i) - vals.at(i) <= tol)
+          continue;
+        if (polys.at(i) == profile.at(i)) {
+          BOOST_LOG_TRIVIAL(warning)
+              << "Game::EPEC::bestResponseDynamicsNash: country " << i
+              << " deviates within its own polyhedron. This might be due to "
+                 "numerical issues";
+          stuck = true;
+          continue;
+        }
+        movers.push_back(i);
+      }
+      if (jacobi)
+        break;
+    }
+    arma::vec MC{};
+    const auto leadFoll = this->getLeadFoll(this->sol_x, MC);
+    this->updateIncumbent(leadFoll, MC, regrets);
+
+    if (movers.empty() && stuck) {
+      this->Stats.numericalIssuesEncountered = true;
+      handOver("a country deviates within its own polyhedron");
+      return;
+    }
+    if (movers.empty()) {
+      this->Stats.status = Game::EPECsolveStatus::nashEqFound;
+      this->Stats.pureNE = this->isPureStrategy();
+      return;
+    }
+    for (const unsigned int i : movers) {
+      BOOST_LOG_TRIVIAL(debug) << "Game::EPEC::bestResponseDynamicsNash: "
+                                  "country "
+                               << i << " moves to polyhedron " << polys.at(i);
+      profile.at(i) = polys.at(i);
+    }
+    next = (movers.back() + 1) % this->nCountr;
+  }
+}
+
 void Game::EPEC::setAlgorithm(Game::EPECalgorithm algorithm)
 /**
  * Decides the algorithm to be used for solving the given instance of the
@@ -2415,69 +4959,77 @@ std::vector<unsigned int> Game::EPEC::mixedStratPoly(const unsigned int i,
   return polys;
 }
 
+std::vector<std::vector<unsigned int>>
+Game::EPEC::getSupport(const arma::vec &x, const double tol) const
+/**
+ * Returns, for each leader, the indices of the polyhedra played with
+ * probability greater than tol in the master LCP solution @p x. Unlike
+ * Game::EPEC::mixedStratPoly, this does not read the solution from
+ * Game::EPEC::sol_x, hence it applies to any solution in the pool.
+ */
+{
+  std::vector<std::vector<unsigned int>> support(this->nCountr);
+  for (unsigned int i = 0; i < this->nCountr; ++i) {
+    const unsigned int nPoly = this->getNPoly_Lead(i);
+    for (unsigned int j = 0; j < nPoly; j++) {
+      const unsigned int pos{this->getPosition_Probab(i, j)};
+      if (pos == 0 || x.at(pos) > tol)
+        support.at(i).push_back(j);
+    }
+  }
+  return support;
+}
+
 double Game::EPEC::getVal_Probab(const unsigned int i,
                                  const unsigned int k) const {
   const unsigned int varname{this->getPosition_Probab(i, k)};
   if (varname == 0)
     return 1;
-  return this->lcpmodel->getVarByName("x_" + std::to_string(varname))
-      .get(GRB_DoubleAttr_X);
+  return this->sol_x.at(varname);
 }
 
 double Game::EPEC::getVal_LeadFoll(const unsigned int i,
                                    const unsigned int j) const {
-  if (!this->lcpmodel)
+  if (this->sol_x.empty())
     throw std::string("Error in Game::EPEC::getVal_LeadFoll: "
-                      "Game::EPEC::lcpmodel not made and solved");
-  return this->lcpmodel
-      ->getVarByName("x_" + to_string(this->getPosition_LeadFoll(i, j)))
-      .get(GRB_DoubleAttr_X);
+                      "the master LCP has not been solved");
+  return this->sol_x.at(this->getPosition_LeadFoll(i, j));
 }
 
 double Game::EPEC::getVal_LeadLead(const unsigned int i,
                                    const unsigned int j) const {
-  if (!this->lcpmodel)
+  if (this->sol_x.empty())
     throw std::string("Error in Game::EPEC::getVal_LeadLead: "
-                      "Game::EPEC::lcpmodel not made and solved");
-  return this->lcpmodel
-      ->getVarByName("x_" + to_string(this->getPosition_LeadLead(i, j)))
-      .get(GRB_DoubleAttr_X);
+                      "the master LCP has not been solved");
+  return this->sol_x.at(this->getPosition_LeadLead(i, j));
 }
 
 double Game::EPEC::getVal_LeadFollPoly(const unsigned int i,
                                        const unsigned int j,
                                        const unsigned int k,
                                        const double tol) const {
-  if (!this->lcpmodel)
+  if (this->sol_x.empty())
     throw std::string("Error in Game::EPEC::getVal_LeadFollPoly: "
-                      "Game::EPEC::lcpmodel not made and solved");
+                      "the master LCP has not been solved");
   const double probab = this->getVal_Probab(i, k);
   if (probab > 1 - tol)
     return this->getVal_LeadFoll(i, j);
   else
-    return this->lcpmodel
-               ->getVarByName(
-                   "x_" + to_string(this->getPosition_LeadFollPoly(i, j, k)))
-               .get(GRB_DoubleAttr_X) /
-           probab;
+    return this->sol_x.at(this->getPosition_LeadFollPoly(i, j, k)) / probab;
 }
 
 double Game::EPEC::getVal_LeadLeadPoly(const unsigned int i,
                                        const unsigned int j,
                                        const unsigned int k,
                                        const double tol) const {
-  if (!this->lcpmodel)
+  if (this->sol_x.empty())
     throw std::string("Error in Game::EPEC::getVal_LeadLeadPoly: "
-                      "Game::EPEC::lcpmodel not made and solved");
+                      "the master LCP has not been solved");
   const double probab = this->getVal_Probab(i, k);
   if (probab > 1 - tol)
     return this->getVal_LeadLead(i, j);
   else
-    return this->lcpmodel
-               ->getVarByName(
-                   "x_" + to_string(this->getPosition_LeadLeadPoly(i, j, k)))
-               .get(GRB_DoubleAttr_X) /
-           probab;
+    return this->sol_x.at(this->getPosition_LeadLeadPoly(i, j, k)) / probab;
 }
 
 std::string std::to_string(const Game::EPECsolveStatus st) {
@@ -2504,6 +5056,12 @@ std::string std::to_string(const Game::EPECalgorithm al) {
     return string("innerApproximation");
   case EPECalgorithm::combinatorialPNE:
     return string("combinatorialPNE");
+  case EPECalgorithm::outerApproximation:
+    return string("outerApproximation");
+  case EPECalgorithm::bestResponseDynamics:
+    return string("bestResponseDynamics");
+  case EPECalgorithm::portfolio:
+    return string("portfolio");
   default:
     return string("UNKNOWN_ALGORITHM_") + to_string(static_cast<int>(al));
   }
@@ -2514,6 +5072,8 @@ std::string std::to_string(const Game::EPECRecoverStrategy strategy) {
     return string("incrementalEnumeration");
   case Game::EPECRecoverStrategy::combinatorial:
     return string("combinatorial");
+  case Game::EPECRecoverStrategy::supportReduction:
+    return string("supportReduction");
   default:
     return string("UNKNOWN_RECOVER_STRATEGY_") +
            to_string(static_cast<int>(strategy));
@@ -2527,17 +5087,59 @@ std::string std::to_string(const Game::EPECAddPolyMethod add) {
     return string("reverse_sequential");
   case EPECAddPolyMethod::random:
     return string("random");
+  case EPECAddPolyMethod::guided:
+    return string("guided");
   default:
     return string("UNKNOWN_ALGORITHM_") + to_string(static_cast<int>(add));
   }
 }
+std::string std::to_string(const Game::EPECDynamics dyn) {
+  switch (dyn) {
+  case EPECDynamics::gaussSeidel:
+    return string("gaussSeidel");
+  case EPECDynamics::jacobi:
+    return string("jacobi");
+  default:
+    return string("UNKNOWN_DYNAMICS_") + to_string(static_cast<int>(dyn));
+  }
+}
 std::string std::to_string(const Game::EPECAlgorithmParams al) {
   std::stringstream ss;
   ss << "Algorithm: " << to_string(al.algorithm) << '\n';
   if (al.algorithm == Game::EPECalgorithm::innerApproximation) {
-    ss << "Aggressiveness: " << al.aggressiveness << '\n';
+    ss << "Aggressiveness: " << al.aggressiveness
+       << (al.adaptiveAggressiveness ? " (adaptive)" : "") << '\n';
     ss << "AddPolyMethod: " << to_string(al.addPolyMethod) << '\n';
+    ss << "TwoPhaseResponse: " << std::boolalpha << al.twoPhaseResponse
+       << '\n';
+    ss << "DevnPoolSize: " << al.devnPoolSize << '\n';
+    ss << "MasterPoolSize: " << al.masterPoolSize << '\n';
+    ss << "Pipelined: " << std::boolalpha << al.pipelined << '\n';
+    ss << "NeighbourExpansion: " << al.neighbourExpansion << '\n';
+    ss << "ContinuationStart: " << al.continuationStart << '\n';
+    if (al.epsilon > 0)
+      ss << "Epsilon: " << al.epsilon << '\n';
+  } else if (al.algorithm == Game::EPECalgorithm::outerApproximation) {
+    ss << "Aggressiveness: " << al.aggressiveness << '\n';
+    ss << "DisjunctiveCuts: " << al.disjunctiveCuts << '\n';
+  } else if (al.algorithm == Game::EPECalgorithm::combinatorialPNE) {
+    ss << "CombinatorialPruning: " << std::boolalpha
+       << al.combinatorialPruning << '\n';
+  } else if (al.algorithm == Game::EPECalgorithm::bestResponseDynamics) {
+    ss << "Dynamics: " << to_string(al.dynamics) << '\n';
+    ss << "DynamicsRounds: " << al.dynamicsRounds << '\n';
+  }
+  // Options of the master LCPs, for the algorithms solving a sequence of them
+  if (al.algorithm == Game::EPECalgorithm::innerApproximation ||
+      al.algorithm == Game::EPECalgorithm::outerApproximation ||
+      al.algorithm == Game::EPECalgorithm::bestResponseDynamics) {
+    ss << "HullCacheSize: " << al.hullCacheSize << '\n';
+    ss << "MasterMIPStart: " << std::boolalpha << al.masterMIPStart << '\n';
   }
+  if (al.masterDecomposition > 0 &&
+      al.algorithm != Game::EPECalgorithm::combinatorialPNE &&
+      al.algorithm != Game::EPECalgorithm::portfolio)
+    ss << "MasterDecomposition: " << al.masterDecomposition << '\n';
   ss << "Time Limit: " << al.timeLimit << '\n';
   ss << "Indicators: " << std::boolalpha << al.indicators;
 
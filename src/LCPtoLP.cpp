@@ -4,12 +4,17 @@
 #include <boost/log/trivial.hpp>
 #include <boost/program_options.hpp>
 #include <cmath>
+#include <future>
 #include <gurobi_c++.h>
 #include <iostream>
+#include <iterator>
+#include <map>
 #include <memory>
+#include <numeric>
 #include <random>
 #include <set>
 #include <string>
+#include <thread>
 
 using namespace std;
 using namespace Utils;
@@ -68,6 +73,7 @@ void Game::LCP::defConst(GRBEnv *env)
   this->env = env;
   this->nR = this->M.n_rows;
   this->nC = this->M.n_cols;
+  this->Blocks.clear();
 }
 
 Game::LCP::LCP(
@@ -185,6 +191,12 @@ void Game::LCP::makeRelaxed()
  * member functions */
 {
   try {
+    // The models copied from LCP::RlxdModel inherit the time left
+    if (this->deadline)
+      this->RlxdModel.set(GRB_DoubleParam_TimeLimit,
+                          this->deadline->isActive()
+                              ? this->deadline->remaining()
+                              : GRB_INFINITY);
     if (this->madeRlxdModel)
       return;
     BOOST_LOG_TRIVIAL(trace)
@@ -504,8 +516,8 @@ Game::LCP::ConvexHull(arma::sp_mat &A, ///< Convex hull inequality description
     return v;
   }(*this->bi);
   arma::sp_mat A_common;
-  A_common = arma::join_cols(this->_A, -this->M);
-  arma::vec b_common = arma::join_cols(this->_b, this->q);
+  arma::vec b_common;
+  this->commonConstraints(A_common, b_common);
   if (Ai->size() == 1) {
     A.zeros(Ai->at(0)->n_rows + A_common.n_rows,
             Ai->at(0)->n_cols + A_common.n_cols);
@@ -517,6 +529,26 @@ Game::LCP::ConvexHull(arma::sp_mat &A, ///< Convex hull inequality description
     return Game::ConvexHull(&tempAi, &tempbi, A, b, A_common, b_common);
 };
 
+void Game::LCP::commonConstraints(
+    arma::sp_mat &A, ///< [out] LHS of the constraints
+    arma::vec &b     ///< [out] RHS of the constraints
+) const
+/**
+ * @brief Writes the constraints valid for every polyhedron of the LCP
+ * @details These are LCP::_A x <= LCP::_b, M x + q >= 0 and the pool of cuts
+ * (see LCP::addDisjunctiveCut), in this order. Together with the
+ * nonnegativity of the variables, they describe the LCP without the
+ * complementarities.
+ */
+{
+  A = arma::join_cols(this->_A, -this->M);
+  b = arma::join_cols(this->_b, this->q);
+  if (this->CutsA.n_rows > 0) {
+    A = arma::join_cols(A, this->CutsA);
+    b = arma::join_cols(b, this->Cutsb);
+  }
+}
+
 unsigned int Game::ConvexHull(
     const vector<arma::sp_mat *>
         *Ai, ///< Inequality constraints LHS that define polyhedra whose convex
@@ -717,6 +749,35 @@ void Game::compConvSize(
   A = arma::sp_mat(locations, val, nFinCons, nFinVar);
 }
 
+void Game::Deadline::set(const double seconds) {
+  /// @brief Expires @p seconds from now. Not positive values clear it
+  this->active = seconds > 0;
+  if (this->active)
+    this->end = std::chrono::high_resolution_clock::now() +
+                std::chrono::duration_cast<
+                    std::chrono::high_resolution_clock::duration>(
+                    std::chrono::duration<double>(seconds));
+}
+
+double Game::Deadline::remaining() const {
+  /// @returns The seconds left, at least 0. -1 if the deadline is inactive
+  if (this->cancelled)
+    return 0;
+  if (!this->active)
+    return -1;
+  const std::chrono::duration<double> left =
+      this->end - std::chrono::high_resolution_clock::now();
+  return std::max(left.count(), 0.0);
+}
+
+void Game::Deadline::apply(GRBModel &model) const {
+  /// @brief Lowers the time limit of @p model to the time left, if active
+  if (this->isActive())
+    model.set(GRB_DoubleParam_TimeLimit,
+              std::min(model.get(GRB_DoubleParam_TimeLimit),
+                       this->remaining()));
+}
+
 arma::vec
 Game::LPSolve(const arma::sp_mat &A, ///< The constraint matrix
               const arma::vec &b,    ///< RHS of the constraint matrix
@@ -724,7 +785,8 @@ Game::LPSolve(const arma::sp_mat &A, ///< The constraint matrix
                                      ///< minimizes along this direction
               int &status, ///< Status of the optimization problem. If optimal,
                            ///< this will be GRB_OPTIMAL
-              bool Positivity ///< Should @f$x\geq0@f$ be enforced?
+              bool Positivity, ///< Should @f$x\geq0@f$ be enforced?
+              const Deadline *deadline ///< If not null, limits the solve
               )
 /**
  Checks if the polyhedron given by @f$ Ax\leq b@f$ is feasible.
@@ -760,6 +822,8 @@ Game::LPSolve(const arma::sp_mat &A, ///< The constraint matrix
   }
   model.set(GRB_IntParam_OutputFlag, VERBOSE);
   model.set(GRB_IntParam_DualReductions, 0);
+  if (deadline)
+    deadline->apply(model);
   model.optimize();
   status = model.get(GRB_IntAttr_Status);
   if (status == GRB_OPTIMAL)
@@ -773,13 +837,15 @@ bool Game::LCP::extractSols(
     ///< Game::LCP::LCPasMIP)
     arma::vec &z, ///< Output variable - where the equation values are stored
     arma::vec &x, ///< Output variable - where the variable values are stored
-    bool extractZ ///< z values are filled only if this is true
+    bool extractZ, ///< z values are filled only if this is true
+    int solNumber ///< If non-negative, the solution with this index in the
+                  ///< solution pool is extracted instead of the best one
 ) const
 /** @brief Extracts variable and equation values from a solved Gurobi model for
    LCP */
 /** @warning This solves the model if the model is not already solve */
-/** @returns @p false if the model is not solved to optimality. @p true
-   otherwise */
+/** @returns @p false if the model is not solved to optimality, or if the
+   requested pool solution does not exist. @p true otherwise */
 {
   if (model->get(GRB_IntAttr_Status) == GRB_LOADED)
     model->optimize();
@@ -787,16 +853,23 @@ bool Game::LCP::extractSols(
   if (!(status == GRB_OPTIMAL || status == GRB_SUBOPTIMAL ||
         status == GRB_SOLUTION_LIMIT))
     return false;
+  GRB_DoubleAttr attr = GRB_DoubleAttr_X;
+  if (solNumber >= 0) {
+    if (solNumber >= model->get(GRB_IntAttr_SolCount))
+      return false;
+    model->set(GRB_IntParam_SolutionNumber, solNumber);
+    attr = GRB_DoubleAttr_Xn;
+  }
   x.zeros(nC);
   if (extractZ)
     z.zeros(nR);
   for (unsigned int i = 0; i < nR; i++) {
-    x[i] = model->getVarByName("x_" + to_string(i)).get(GRB_DoubleAttr_X);
+    x[i] = model->getVarByName("x_" + to_string(i)).get(attr);
     if (extractZ)
-      z[i] = model->getVarByName("z_" + to_string(i)).get(GRB_DoubleAttr_X);
+      z[i] = model->getVarByName("z_" + to_string(i)).get(attr);
   }
   for (unsigned int i = nR; i < nC; i++)
-    x[i] = model->getVarByName("x_" + to_string(i)).get(GRB_DoubleAttr_X);
+    x[i] = model->getVarByName("x_" + to_string(i)).get(attr);
   return true;
 }
 
@@ -897,6 +970,22 @@ LCP &Game::LCP::addPolyFromX(const arma::vec &x, bool &ret)
   return *this;
 }
 
+unsigned long int Game::LCP::polyFromX(const arma::vec &x) const
+/**
+ * @brief Decimal encoding of a polyhedron containing the <i> feasible </i>
+ * point @p x
+ * @details As in LCP::addPolyFromX, complementarities where both sides are
+ * zero are fixed on the equation side.
+ */
+{
+  vector<short int> encoding = this->solEncode(x);
+  for (short &i : encoding) {
+    if (i == 0)
+      ++i;
+  }
+  return vec_to_num(encoding);
+}
+
 bool Game::LCP::FixToPoly(
     const vector<short int>
         Fix,        ///< A vector of +1 and -1 referring to which
@@ -944,31 +1033,15 @@ bool Game::LCP::FixToPoly(
     }
   }
 
+  for (const auto fix : Fix)
+    if (fix == 0)
+      throw string(
+          "Error in Game::LCP::FixToPoly. 0s not allowed in argument vector");
   unique_ptr<arma::sp_mat> Aii =
       unique_ptr<arma::sp_mat>(new arma::sp_mat(nR, nC));
-  Aii->zeros();
   unique_ptr<arma::vec> bii =
       unique_ptr<arma::vec>(new arma::vec(nR, arma::fill::zeros));
-  for (unsigned int i = 0; i < this->nR; i++) {
-    if (Fix.at(i) == 0) {
-      throw string(
-          "Error in Game::LCP::FixToPoly. 0s not allowed in argument vector");
-    }
-    if (Fix.at(i) == 1) // Equation to be fixed top zero
-    {
-      for (auto j = this->M.begin_row(i); j != this->M.end_row(i); ++j)
-        if (!this->isZero((*j)))
-          Aii->at(i, j.col()) =
-              (*j); // Only mess with non-zero elements of a sparse matrix!
-      bii->at(i) = -this->q(i);
-    } else // Variable to be fixed to zero, i.e. x(j) <= 0 constraint to be
-    // added
-    {
-      unsigned int varpos = (i >= this->LeadStart) ? i + this->nLeader : i;
-      Aii->at(i, varpos) = 1;
-      bii->at(i) = 0;
-    }
-  }
+  this->polyFromFix(Fix, *Aii, *bii);
   bool add = !checkFeas;
   if (checkFeas) {
     add = this->checkPolyFeas(Fix);
@@ -979,6 +1052,7 @@ bool Game::LCP::FixToPoly(
       custbi->push_back(std::move(bii));
     } else {
       AllPolyhedra.insert(FixNumber);
+      this->PolyOrder.push_back(FixNumber);
       this->Ai->push_back(std::move(Aii));
       this->bi->push_back(std::move(bii));
     }
@@ -987,6 +1061,37 @@ bool Game::LCP::FixToPoly(
   return false;
 }
 
+void Game::LCP::polyFromFix(
+    const vector<short int> &Fix, ///< A vector of +1, -1 and 0 referring to
+                                  ///< which equations and variables are
+                                  ///< taking 0 value
+    arma::sp_mat &A,              ///< LHS of the polyhedron, of size nR x nC
+    arma::vec &b                  ///< RHS of the polyhedron, of size nR
+) const {
+  /// @brief Writes the constraints fixing the complementarities in @p Fix
+  /// @details Row i fixes the i-th equation to zero if @p Fix is +1 there, and
+  /// the corresponding variable if it is -1. The row is left empty if it is
+  /// 0, so that the complementarity is relaxed.
+  A.zeros(this->nR, this->nC);
+  b.zeros(this->nR);
+  for (unsigned int i = 0; i < this->nR; i++) {
+    if (Fix.at(i) == 1) // Equation to be fixed top zero
+    {
+      for (auto j = this->M.begin_row(i); j != this->M.end_row(i); ++j)
+        if (!this->isZero((*j)))
+          A.at(i, j.col()) =
+              (*j); // Only mess with non-zero elements of a sparse matrix!
+      b.at(i) = -this->q(i);
+    } else if (Fix.at(i) == -1) // Variable to be fixed to zero, i.e. x(j) <=
+                                // 0 constraint to be added
+    {
+      unsigned int varpos = (i >= this->LeadStart) ? i + this->nLeader : i;
+      A.at(i, varpos) = 1;
+      b.at(i) = 0;
+    }
+  }
+}
+
 bool Game::LCP::checkPolyFeas(
     const unsigned long int
         &decimalEncoding ///< Decimal encoding for the polyhedron
@@ -1014,26 +1119,28 @@ bool Game::LCP::checkPolyFeas(
     return true;
   }
 
-  unsigned int count{0};
   try {
+    if (this->getBlocks().size() > 1) {
+      // Feasible if and only if the fixes of every block are
+      for (unsigned int k = 0; k < this->Blocks.size(); ++k) {
+        if (this->checkBlockFeas(k, Fix))
+          continue;
+        if (this->blockInfeas.at(k).count(this->blockFix(k, Fix)))
+          knownInfeas.insert(FixNumber);
+        return false;
+      }
+      feasiblePoly.insert(FixNumber);
+      return true;
+    }
     makeRelaxed();
     GRBModel model(this->RlxdModel);
-    for (auto i : Fix) {
-      if (i > 0)
-        model.getVarByName("z_" + to_string(count)).set(GRB_DoubleAttr_UB, 0);
-      if (i < 0)
-        model
-            .getVarByName("x_" + to_string(count >= this->LeadStart
-                                               ? count + nLeader
-                                               : count))
-            .set(GRB_DoubleAttr_UB, 0);
-      count++;
-    }
     model.set(GRB_IntParam_OutputFlag, VERBOSE);
-    model.optimize();
-    if (model.get(GRB_IntAttr_Status) == GRB_OPTIMAL) {
+    if (this->solvePolyFeas(model, Fix)) {
       feasiblePoly.insert(FixNumber);
       return true;
+    } else if (model.get(GRB_IntAttr_Status) == GRB_TIME_LIMIT) {
+      // Out of time: the polyhedron is not known to be infeasible
+      return false;
     } else {
       BOOST_LOG_TRIVIAL(trace)
           << "Game::LCP::checkPolyFeas: Detected infeasibility of " << FixNumber
@@ -1058,6 +1165,431 @@ bool Game::LCP::checkPolyFeas(
   return false;
 }
 
+void Game::LCP::fixPoly(
+    GRBModel &model, ///< A copy of LCP::RlxdModel
+    const vector<short int> &Fix ///< A vector of +1, -1 and 0. See
+                                 ///< LCP::polyFromFix
+) const {
+  /// @brief Restricts @p model to the polyhedron @p Fix, by fixing to zero
+  /// the equations and variables it selects
+  unsigned int count{0};
+  for (auto i : Fix) {
+    if (i > 0)
+      model.getVarByName("z_" + to_string(count)).set(GRB_DoubleAttr_UB, 0);
+    if (i < 0)
+      model
+          .getVarByName("x_" + to_string(count >= this->LeadStart
+                                             ? count + nLeader
+                                             : count))
+          .set(GRB_DoubleAttr_UB, 0);
+    count++;
+  }
+}
+
+bool Game::LCP::solvePolyFeas(
+    GRBModel &model, ///< A copy of LCP::RlxdModel
+    const vector<short int> &Fix ///< A vector of +1 and -1 referring to which
+                                 ///< equations and variables are taking 0
+                                 ///< value.
+) const {
+  /// @brief Fixes the polyhedron @p Fix in @p model, and solves it
+  /// @returns true if the polyhedron is feasible
+  this->fixPoly(model, Fix);
+  model.optimize();
+  return model.get(GRB_IntAttr_Status) == GRB_OPTIMAL;
+}
+
+std::vector<unsigned long int> Game::LCP::checkPolyFeas(
+    const std::vector<unsigned long int>
+        &polys, ///< Decimal encoding of the polyhedra to check
+    const std::vector<GRBEnv *>
+        &envs ///< Gurobi environments of the workers, one per worker
+) {
+  /**
+   * @brief Checks the feasibility of a batch of polyhedra in parallel
+   * @details Polyhedra already known to be feasible or infeasible are not
+   * solved again. The others are split among workers, each one with its own
+   * environment in @p envs and its own copy of LCP::RlxdModel. The
+   * environments are owned by the caller, so that they are made once rather
+   * than at every batch. With several blocks (see LCP::getBlocks), the
+   * workers solve the distinct fixes of the blocks not memoized yet, and the
+   * polyhedra are settled from them as in LCP::checkBlockFeas. Workers are
+   * only started with at least two models each to solve; smaller batches
+   * are checked one at a time by
+   * LCP::checkPolyFeas(const std::vector<short int> &). The outcomes are
+   * recorded as in that function.
+   * @returns The feasible polyhedra in @p polys, in the same order
+   */
+  const unsigned int nCompl = this->Compl.size();
+  std::vector<char> feasible(polys.size(), 0);
+  std::vector<unsigned int> unknown{};
+  const bool byBlock = this->getBlocks().size() > 1;
+  for (unsigned int k = 0; k < polys.size(); ++k) {
+    // The memoized blocks may settle the polyhedron (see LCP::getBlocks)
+    const int verdict = this->blockVerdict(num_to_vec(polys.at(k), nCompl));
+    if (verdict == 1)
+      this->feasiblePoly.insert(polys.at(k));
+    else if (verdict == 0)
+      this->knownInfeas.insert(polys.at(k));
+    if (this->feasiblePoly.find(polys.at(k)) != this->feasiblePoly.end())
+      feasible.at(k) = 1;
+    else if (this->knownInfeas.find(polys.at(k)) == this->knownInfeas.end())
+      unknown.push_back(k);
+  }
+  // The models to solve: the polyhedra themselves, or the fixes of their
+  // blocks, each one once
+  std::vector<vector<short int>> jobs{};
+  std::vector<std::pair<unsigned int, unsigned long int>> jobBlocks{};
+  if (byBlock) {
+    std::set<std::pair<unsigned int, unsigned long int>> queued{};
+    for (const auto k : unknown) {
+      const vector<short int> Fix = num_to_vec(polys.at(k), nCompl);
+      for (unsigned int b = 0; b < this->Blocks.size(); ++b) {
+        const unsigned long int key = this->blockFix(b, Fix);
+        if (this->blockFeas.at(b).count(key) ||
+            this->blockInfeas.at(b).count(key) ||
+            !queued.insert({b, key}).second)
+          continue;
+        vector<short int> partial(this->nR, 0);
+        for (const auto i : this->Blocks.at(b))
+          partial.at(i) = Fix.at(i);
+        jobs.push_back(partial);
+        jobBlocks.push_back({b, key});
+      }
+    }
+  } else
+    for (const auto k : unknown)
+      jobs.push_back(num_to_vec(polys.at(k), nCompl));
+
+  const unsigned int threads = std::min<unsigned int>(
+      envs.size(), static_cast<unsigned int>(jobs.size() / 2));
+  if (!unknown.empty() && threads <= 1) {
+    for (const auto k : unknown) {
+      if (this->deadline && this->deadline->expired())
+        break;
+      if (this->checkPolyFeas(num_to_vec(polys.at(k), nCompl)))
+        feasible.at(k) = 1;
+    }
+  } else if (!unknown.empty()) {
+    makeRelaxed();
+    // Gurobi environments are not thread safe: the models are copied here,
+    // and only solved by the workers
+    std::vector<std::unique_ptr<GRBModel>> base{};
+    for (unsigned int w = 0; w < threads; ++w)
+      base.push_back(std::unique_ptr<GRBModel>(
+          new GRBModel(this->RlxdModel, *envs.at(w))));
+    // Models left unsolved by the deadline are not recorded
+    std::vector<char> jobFeasible(jobs.size(), 0), solved(jobs.size(), 0);
+    std::vector<std::future<void>> workers{};
+    for (unsigned int w = 0; w < threads; ++w)
+      workers.push_back(std::async(std::launch::async, [&, w]() {
+        for (unsigned int j = w; j < jobs.size(); j += threads) {
+          if (this->deadline && this->deadline->expired())
+            return;
+          GRBModel model(*base.at(w));
+          if (this->deadline)
+            this->deadline->apply(model);
+          jobFeasible.at(j) = this->solvePolyFeas(model, jobs.at(j));
+          solved.at(j) = model.get(GRB_IntAttr_Status) != GRB_TIME_LIMIT;
+        }
+      }));
+    try {
+      for (auto &w : workers)
+        w.get();
+    } catch (GRBException &e) {
+      cerr << "GRBException: Error in Game::LCP::checkPolyFeas: "
+           << e.getErrorCode() << ": " << e.getMessage() << '\n';
+      throw;
+    } catch (exception &e) {
+      cerr << "Exception: Error in Game::LCP::checkPolyFeas: " << e.what()
+           << '\n';
+      throw;
+    }
+    if (byBlock) {
+      for (unsigned int j = 0; j < jobs.size(); ++j) {
+        const auto &block = jobBlocks.at(j);
+        if (jobFeasible.at(j))
+          this->blockFeas.at(block.first).insert(block.second);
+        else if (solved.at(j))
+          this->blockInfeas.at(block.first).insert(block.second);
+      }
+      for (const auto k : unknown) {
+        const int verdict =
+            this->blockVerdict(num_to_vec(polys.at(k), nCompl));
+        if (verdict == 1) {
+          feasible.at(k) = 1;
+          this->feasiblePoly.insert(polys.at(k));
+        } else if (verdict == 0)
+          this->knownInfeas.insert(polys.at(k));
+      }
+    } else
+      for (unsigned int j = 0; j < jobs.size(); ++j) {
+        const auto k = unknown.at(j);
+        if (jobFeasible.at(j)) {
+          feasible.at(k) = 1;
+          this->feasiblePoly.insert(polys.at(k));
+        } else if (solved.at(j))
+          this->knownInfeas.insert(polys.at(k));
+      }
+  }
+  std::vector<unsigned long int> ret{};
+  for (unsigned int k = 0; k < polys.size(); ++k)
+    if (feasible.at(k))
+      ret.push_back(polys.at(k));
+  return ret;
+}
+
+bool Game::LCP::addOuterPoly(
+    const std::vector<short int> &Fix, ///< A vector of +1, -1 and 0. See
+                                       ///< LCP::polyFromFix
+    bool checkFeas ///< The polyhedron is added only if it is not proven
+                   ///< infeasible, if this is true
+) {
+  /**
+   * @brief Adds a polyhedron to the outer approximation of the LCP feasible
+   * region
+   * @details The complementarities that are 0 in @p Fix are relaxed, hence
+   * the polyhedron contains every polyhedron of LCP::Ai fixing them either
+   * way. With all of them 0, this is the feasible region of LCP::RlxdModel.
+   * Outer polyhedra are kept in LCP::Ai and LCP::bi like the others, but are
+   * tracked by LCP::OuterPolys instead of LCP::AllPolyhedra: the two kinds
+   * are not meant to be mixed (see LCP::clearPolyhedra).
+   * If time runs out while checking, the polyhedron is added anyway, since
+   * it is not known to be infeasible.
+   * @returns true if the polyhedron is added
+   */
+  if (Fix.size() != this->nR)
+    throw string("Error in Game::LCP::addOuterPoly: invalid size of Fix");
+  if (checkFeas) {
+    makeRelaxed();
+    GRBModel model(this->RlxdModel);
+    model.set(GRB_IntParam_OutputFlag, VERBOSE);
+    if (!this->solvePolyFeas(model, Fix) &&
+        model.get(GRB_IntAttr_Status) != GRB_TIME_LIMIT) {
+      BOOST_LOG_TRIVIAL(trace) << "Game::LCP::addOuterPoly: Detected "
+                                  "infeasibility (GRB_STATUS="
+                               << model.get(GRB_IntAttr_Status) << ")";
+      return false;
+    }
+  }
+  unique_ptr<arma::sp_mat> Aii(new arma::sp_mat(nR, nC));
+  unique_ptr<arma::vec> bii(new arma::vec(nR, arma::fill::zeros));
+  this->polyFromFix(Fix, *Aii, *bii);
+  this->OuterPolys.push_back(Fix);
+  this->Ai->push_back(std::move(Aii));
+  this->bi->push_back(std::move(bii));
+  return true;
+}
+
+unsigned int Game::LCP::branchOuterPoly(
+    const unsigned int k,   ///< Position of the polyhedron in LCP::OuterPolys
+    const unsigned int pair ///< Index of a complementarity it relaxes
+) {
+  /**
+   * @brief Replaces the @p k-th polyhedron of the outer approximation by its
+   * two children on the complementarity @p pair
+   * @details The children fix the equation and the variable of @p pair to
+   * zero respectively, and are added at the end by LCP::addOuterPoly. Those
+   * proven infeasible are dropped, so the union of the polyhedra still
+   * contains the LCP feasible region.
+   * @returns The number of children added, 0 if the polyhedron contains no
+   * solution of the LCP
+   */
+  if (k >= this->OuterPolys.size())
+    throw string("Error in Game::LCP::branchOuterPoly: invalid polyhedron");
+  std::vector<short int> Fix = this->OuterPolys.at(k);
+  if (pair >= Fix.size() || Fix.at(pair) != 0)
+    throw string("Error in Game::LCP::branchOuterPoly: the complementarity " +
+                 to_string(pair) + " is not relaxed");
+  this->OuterPolys.erase(this->OuterPolys.begin() + k);
+  this->Ai->erase(this->Ai->begin() + k);
+  this->bi->erase(this->bi->begin() + k);
+  unsigned int added{0};
+  for (const short int side : {1, -1}) {
+    Fix.at(pair) = side;
+    if (this->addOuterPoly(Fix))
+      ++added;
+  }
+  return added;
+}
+
+bool Game::LCP::addDisjunctiveCut(
+    const arma::vec &x,     ///< A point violating the complementarity @p pair
+    const unsigned int pair ///< Index of the equation of the complementarity
+) {
+  /**
+   * @brief Separates @p x from the LCP feasible region with a lift-and-project
+   * cut on the complementarity @p pair
+   * @details Let @f$P@f$ be the feasible region of LCP::RlxdModel, tightened
+   * by the cuts already in the pool. Every solution of the LCP lies either in
+   * @f$P \cap \{z_i \le 0\}@f$ or in @f$P \cap \{x_j \le 0\}@f$, where
+   * @f$(i,j)@f$ is @p pair. The cut @f$\alpha^\top x\le\beta@f$ most violated
+   * by @p x among those valid for both is found with the cut generating LP
+   * of Balas, where @f$\alpha@f$ and @f$\beta@f$ are combinations of the
+   * constraints of each disjunct with multipliers summing up to one.
+   * The cut is valid for the whole feasible region, so it is kept in
+   * LCP::CutsA and LCP::Cutsb and shared by all the polyhedra in
+   * LCP::ConvexHull.
+   *
+   * <b>Cross reference:</b> Balas, Egon; Ceria, Sebastián; and Cornuéjols,
+   * Gérard. A lift-and-project cutting plane algorithm for mixed 0-1
+   * programs. Mathematical Programming 58 (1993).
+   * @returns true if a cut violated by more than LCP::eps is added
+   */
+  long int var{-1};
+  for (const auto p : this->Compl)
+    if (p.first == pair)
+      var = p.second;
+  if (var < 0 || x.n_elem != this->nC)
+    throw string("Error in Game::LCP::addDisjunctiveCut: invalid arguments");
+  try {
+    GRBModel model(*this->env);
+    model.set(GRB_IntParam_OutputFlag, VERBOSE);
+    if (this->deadline)
+      this->deadline->apply(model);
+    GRBVar alpha[this->nC];
+    for (unsigned int c = 0; c < this->nC; ++c)
+      alpha[c] = model.addVar(-GRB_INFINITY, GRB_INFINITY, x.at(c),
+                              GRB_CONTINUOUS, "alpha_" + to_string(c));
+    GRBVar beta = model.addVar(-GRB_INFINITY, GRB_INFINITY, -1,
+                               GRB_CONTINUOUS, "beta");
+    GRBLinExpr normalization{0};
+    // One side of the disjunction: the rows of P, plus z_i <= 0 if equation
+    for (const bool equation : {true, false}) {
+      std::vector<GRBLinExpr> lhs(this->nC, 0);
+      GRBLinExpr rhs{0};
+      const auto addRow = [&](const arma::sp_mat &A, const unsigned int r,
+                              const double sign, const double b) {
+        GRBVar u = model.addVar(0, GRB_INFINITY, 0, GRB_CONTINUOUS);
+        for (auto a = A.begin_row(r); a != A.end_row(r); ++a)
+          lhs.at(a.col()) += sign * (*a) * u;
+        rhs += b * u;
+        normalization += u;
+      };
+      for (unsigned int r = 0; r < this->_A.n_rows; ++r)
+        addRow(this->_A, r, 1, this->_b.at(r));
+      // Mx + q >= 0
+      for (unsigned int r = 0; r < this->nR; ++r)
+        addRow(this->M, r, -1, this->q.at(r));
+      for (unsigned int r = 0; r < this->CutsA.n_rows; ++r)
+        addRow(this->CutsA, r, 1, this->Cutsb.at(r));
+      if (equation)
+        addRow(this->M, pair, 1, -this->q.at(pair));
+      for (unsigned int c = 0; c < this->nC; ++c) {
+        // x >= 0, and x_j <= 0 on the other side
+        GRBVar w = model.addVar(0, GRB_INFINITY, 0, GRB_CONTINUOUS);
+        normalization += w;
+        if (!equation && c == static_cast<unsigned int>(var)) {
+          GRBVar u = model.addVar(0, GRB_INFINITY, 0, GRB_CONTINUOUS);
+          normalization += u;
+          lhs.at(c) += u;
+        }
+        model.addConstr(alpha[c], GRB_EQUAL, lhs.at(c) - w);
+      }
+      model.addConstr(beta, GRB_GREATER_EQUAL, rhs);
+    }
+    model.addConstr(normalization, GRB_EQUAL, 1);
+    model.set(GRB_IntAttr_ModelSense, GRB_MAXIMIZE);
+    model.optimize();
+    if (model.get(GRB_IntAttr_Status) != GRB_OPTIMAL ||
+        model.get(GRB_DoubleAttr_ObjVal) <= this->eps)
+      return false;
+
+    arma::sp_mat cut(1, this->nC);
+    for (unsigned int c = 0; c < this->nC; ++c) {
+      const double coeff = alpha[c].get(GRB_DoubleAttr_X);
+      if (!this->isZero(coeff))
+        cut.at(0, c) = coeff;
+    }
+    this->CutsA = arma::join_cols(this->CutsA, cut);
+    this->Cutsb =
+        arma::join_cols(this->Cutsb, arma::vec{beta.get(GRB_DoubleAttr_X)});
+    BOOST_LOG_TRIVIAL(trace) << "Game::LCP::addDisjunctiveCut: violation "
+                             << model.get(GRB_DoubleAttr_ObjVal)
+                             << " on complementarity " << pair;
+    return true;
+  } catch (GRBException &e) {
+    cerr << "GRBException in Game::LCP::addDisjunctiveCut: "
+         << e.getErrorCode() << ": " << e.getMessage() << '\n';
+    throw;
+  }
+}
+
+long int Game::LCP::mostViolatedCompl(
+    const arma::vec &x, ///< Values of the variables of the LCP
+    double &violation   ///< Output: the violation of the pair returned
+) const {
+  /**
+   * @brief Finds the complementarity most violated by @p x
+   * @details The violation of a pair is the smaller of its equation and its
+   * variable. Violations up to LCP::eps are ignored.
+   * @returns The index of the equation of the pair, or -1 if @p x satisfies
+   * all the complementarities
+   */
+  const arma::vec z = this->M * x + this->q;
+  long int worst{-1};
+  violation = 0;
+  for (const auto p : this->Compl) {
+    const double viol = std::min(z.at(p.first), x.at(p.second));
+    if (viol > this->eps && viol > violation) {
+      worst = p.first;
+      violation = viol;
+    }
+  }
+  return worst;
+}
+
+std::vector<unsigned long int> Game::LCP::getNeighbourPolys(
+    const arma::vec &x, ///< A feasible point, possibly degenerate. Ignored if
+                        ///< empty
+    const std::vector<unsigned long int>
+        &polys ///< Decimal encoding of further polyhedra
+) const {
+  /**
+   * @brief Lists the polyhedra at Hamming distance 1 from the one containing
+   * @p x and from each of @p polys
+   * @details The encoding of @p x is made into a definite polyhedron, as in
+   * LCP::addPolyFromX, by turning its 0 entries into +1. Its neighbours
+   * flipping a 0 entry come first, since they contain @p x as well. Then come
+   * the other neighbours of @p x, and the neighbours of @p polys. Polyhedra
+   * already in the inner approximation, or known to be infeasible, are
+   * skipped.
+   * @returns The decimal encoding of the neighbours, without duplicates
+   */
+  const unsigned int nCompl = this->Compl.size();
+  std::vector<std::vector<short int>> seeds{};
+  std::vector<unsigned int> degenerate{};
+  if (!x.empty()) {
+    auto encoding = this->solEncode(x);
+    for (unsigned int k = 0; k < encoding.size(); ++k)
+      if (encoding.at(k) == 0) {
+        encoding.at(k) = 1;
+        degenerate.push_back(k);
+      }
+    seeds.push_back(encoding);
+  }
+  for (const auto poly : polys)
+    seeds.push_back(num_to_vec(poly, nCompl));
+
+  std::vector<unsigned long int> neighbours{};
+  std::set<unsigned long int> seen(this->AllPolyhedra);
+  seen.insert(this->knownInfeas.begin(), this->knownInfeas.end());
+  const auto flip = [&neighbours, &seen](std::vector<short int> encoding,
+                                         const unsigned int k) {
+    encoding.at(k) = -encoding.at(k);
+    const auto neighbour = vec_to_num(encoding);
+    if (seen.insert(neighbour).second)
+      neighbours.push_back(neighbour);
+  };
+  if (!x.empty())
+    for (const auto k : degenerate)
+      flip(seeds.front(), k);
+  for (const auto &seed : seeds)
+    for (unsigned int k = 0; k < seed.size(); ++k)
+      flip(seed, k);
+  return neighbours;
+}
+
 Game::LCP &Game::LCP::FixToPolies(
     const vector<short int>
         Fix,        ///< A vector of +1, 0 and -1 referring to which
@@ -1086,6 +1618,9 @@ Game::LCP &Game::LCP::FixToPolies(
  *high-level usage.
  */
 {
+  // Past the deadline, the enumeration is left incomplete
+  if (this->deadline && this->deadline->expired())
+    return *this;
   bool flag = false; // flag that there may be multiple polyhedra, i.e. 0 in
                      // some Fix entry
   vector<short int> MyFix(Fix);
@@ -1156,6 +1691,41 @@ unsigned long int Game::LCP::getNextPoly(Game::EPECAddPolyMethod method) {
         return randomPolyId;
     }
   }
+  case Game::EPECAddPolyMethod::guided: {
+    if (this->guidedBase.size() != this->Compl.size())
+      return this->getNextPoly(Game::EPECAddPolyMethod::sequential);
+    // Sets of flipped fixes are enumerated by nondecreasing cost: the
+    // successors of a set are obtained by adding the next fix, or by
+    // replacing its last fix with the next one.
+    while (!this->guidedHeap.empty()) {
+      const auto top = this->guidedHeap.top();
+      this->guidedHeap.pop();
+      const auto &flips = top.second;
+      const unsigned int next = flips.empty() ? 0 : flips.back() + 1;
+      if (next < this->guidedDelta.size()) {
+        auto added = flips;
+        added.push_back(next);
+        this->guidedHeap.push({top.first + this->guidedDelta.at(next), added});
+        if (!flips.empty()) {
+          auto replaced = flips;
+          replaced.back() = next;
+          this->guidedHeap.push({top.first -
+                                     this->guidedDelta.at(flips.back()) +
+                                     this->guidedDelta.at(next),
+                                 replaced});
+        }
+      }
+      auto Fix = this->guidedBase;
+      for (const auto f : flips)
+        Fix.at(this->guidedOrder.at(f)) *= -1;
+      const unsigned long int poly = vec_to_num(Fix);
+      const bool isAll = AllPolyhedra.find(poly) != AllPolyhedra.end();
+      const bool isInfeas = knownInfeas.find(poly) != knownInfeas.end();
+      if (!isAll && !isInfeas)
+        return poly;
+    }
+    return this->maxTheoreticalPoly;
+  }
   default: {
     BOOST_LOG_TRIVIAL(error)
         << "Error in Game::LCP::getNextPoly: unrecognized method "
@@ -1204,6 +1774,8 @@ Game::LCP::addAPoly(unsigned long int nPoly, Game::EPECAddPolyMethod method,
 
   bool complete{false};
   while (!complete) {
+    if (this->deadline && this->deadline->expired())
+      return Polys;
     unsigned long int choice_decimal = this->getNextPoly(method);
     if (choice_decimal >= this->maxTheoreticalPoly)
       return Polys;
@@ -1221,6 +1793,67 @@ Game::LCP::addAPoly(unsigned long int nPoly, Game::EPECAddPolyMethod method,
   }
   return Polys;
 }
+void Game::LCP::setGuidePoint(const arma::vec &x)
+/**
+ * @brief Ranks the polyhedra for Game::EPECAddPolyMethod::guided
+ * @details For each complementarity pair, the fix agreeing best with @p x is
+ * the one setting to zero the smaller of the equation and the variable. Ties
+ * are broken with a solution of the LP relaxation of the LCP, which is also
+ * used in place of @p x if the latter does not have LCP::getNcol elements.
+ * A polyhedron then costs the sum, over the pairs where it takes the other
+ * fix, of the difference between the two values. LCP::getNextPoly returns the
+ * polyhedra by nondecreasing cost.
+ */
+{
+  arma::vec rlxX, rlxZ;
+  bool rlxDone{false};
+  const auto relaxation = [this, &rlxX, &rlxZ, &rlxDone]() {
+    if (rlxDone)
+      return;
+    rlxDone = true;
+    this->makeRelaxed();
+    GRBModel model(this->RlxdModel);
+    if (!this->extractSols(&model, rlxZ, rlxX, true)) {
+      rlxX.zeros(this->nC);
+      rlxZ = this->q;
+    }
+  };
+  arma::vec point = x;
+  if (point.n_elem != this->nC) {
+    relaxation();
+    point = rlxX;
+  }
+  const arma::vec eqn = this->M * point + this->q;
+
+  const unsigned int nCompl = this->Compl.size();
+  this->guidedBase = std::vector<short int>(nCompl, 0);
+  std::vector<double> delta(nCompl, 0);
+  unsigned int count{0};
+  for (const auto p : this->Compl) {
+    double zVal = std::abs(eqn.at(p.first));
+    double xVal = std::abs(point.at(p.second));
+    delta.at(count) = std::abs(zVal - xVal);
+    if (this->isZero(zVal - xVal)) {
+      relaxation();
+      zVal = std::abs(rlxZ.at(p.first));
+      xVal = std::abs(rlxX.at(p.second));
+    }
+    this->guidedBase.at(count) = zVal <= xVal ? 1 : -1;
+    ++count;
+  }
+  this->guidedOrder = std::vector<unsigned int>(nCompl);
+  std::iota(this->guidedOrder.begin(), this->guidedOrder.end(), 0);
+  std::stable_sort(this->guidedOrder.begin(), this->guidedOrder.end(),
+                   [&delta](unsigned int a, unsigned int b) {
+                     return delta.at(a) < delta.at(b);
+                   });
+  this->guidedDelta.clear();
+  for (const auto k : this->guidedOrder)
+    this->guidedDelta.push_back(delta.at(k));
+  this->guidedHeap = decltype(this->guidedHeap){};
+  this->guidedHeap.push({0, {}});
+}
+
 bool Game::LCP::addThePoly(const unsigned long int &decimalEncoding) {
   if (this->maxTheoreticalPoly < decimalEncoding) {
     // This polyhedron does not exist
@@ -1234,6 +1867,184 @@ bool Game::LCP::addThePoly(const unsigned long int &decimalEncoding) {
   return this->FixToPoly(choice, true);
 }
 
+const std::vector<std::vector<unsigned int>> &Game::LCP::getBlocks() {
+  /**
+   * @brief Splits the complementarities into independent blocks
+   * @details Two complementarities are in the same block if they are linked
+   * by a chain of rows of LCP::M or LCP::_A sharing a variable. Since no
+   * constraint then spans two blocks, the feasible region is the product of
+   * the feasible regions of the blocks, and a polyhedron is feasible if and
+   * only if the fixes of each block are, with the other complementarities
+   * relaxed. The feasibility of the fixes of each block is memoized (see
+   * LCP::checkBlockFeas), so that checking the polyhedra costs the sum of
+   * the @f$2^{n_k}@f$ fixes of the blocks, rather than their product.
+   *
+   * The convex hull is still made over the polyhedra of the whole LCP, since
+   * each of them needs its own weight in the master LCP (see
+   * LCP::conv_PolyWt).
+   * @returns The equation indices of the complementarities of each block
+   */
+  if (!this->Blocks.empty() || this->nR == 0)
+    return this->Blocks;
+  // Union-find over the variables
+  std::vector<unsigned int> parent(this->nC);
+  std::iota(parent.begin(), parent.end(), 0);
+  const auto find = [&parent](unsigned int v) {
+    while (parent.at(v) != v) {
+      parent.at(v) = parent.at(parent.at(v));
+      v = parent.at(v);
+    }
+    return v;
+  };
+  const auto unite = [&parent, &find](unsigned int a, unsigned int b) {
+    parent.at(find(a)) = find(b);
+  };
+  for (unsigned int i = 0; i < this->nR; ++i) {
+    const unsigned int var = (i >= this->LeadStart) ? i + this->nLeader : i;
+    for (auto j = this->M.begin_row(i); j != this->M.end_row(i); ++j)
+      if (!this->isZero(*j))
+        unite(var, j.col());
+  }
+  for (unsigned int r = 0; r < this->_A.n_rows; ++r) {
+    long int first{-1};
+    for (auto a = this->_A.begin_row(r); a != this->_A.end_row(r); ++a) {
+      if (this->isZero(*a))
+        continue;
+      if (first < 0)
+        first = a.col();
+      else
+        unite(first, a.col());
+    }
+  }
+  std::map<unsigned int, unsigned int> blockOf{};
+  for (unsigned int i = 0; i < this->nR; ++i) {
+    const unsigned int var = (i >= this->LeadStart) ? i + this->nLeader : i;
+    const auto it = blockOf.emplace(find(var), this->Blocks.size()).first;
+    if (it->second == this->Blocks.size())
+      this->Blocks.push_back({});
+    this->Blocks.at(it->second).push_back(i);
+  }
+  this->blockFeas.assign(this->Blocks.size(), {});
+  this->blockInfeas.assign(this->Blocks.size(), {});
+  BOOST_LOG_TRIVIAL(debug) << "Game::LCP::getBlocks: " << this->Blocks.size()
+                           << " independent blocks";
+  return this->Blocks;
+}
+
+unsigned long int Game::LCP::blockFix(
+    const unsigned int k,        ///< Block index
+    const vector<short int> &Fix ///< +1/-1 on the block @p k
+) const {
+  /// @brief Decimal encoding of the fixes of the block @p k in @p Fix
+  vector<short int> local{};
+  for (const auto i : this->Blocks.at(k))
+    local.push_back(Fix.at(i));
+  return vec_to_num(local);
+}
+
+int Game::LCP::blockVerdict(const vector<short int> &Fix) const {
+  /**
+   * @brief Feasibility of the polyhedron @p Fix from the memoized
+   * feasibility of its blocks
+   * @returns 0 if some block is known to be infeasible, 1 if all of them are
+   * known to be feasible, -1 otherwise or if there is a single block
+   */
+  if (this->Blocks.size() < 2)
+    return -1;
+  int verdict{1};
+  for (unsigned int k = 0; k < this->Blocks.size(); ++k) {
+    const unsigned long int key = this->blockFix(k, Fix);
+    if (this->blockInfeas.at(k).count(key))
+      return 0;
+    if (!this->blockFeas.at(k).count(key))
+      verdict = -1;
+  }
+  return verdict;
+}
+
+bool Game::LCP::checkBlockFeas(
+    const unsigned int k,        ///< Block index
+    const vector<short int> &Fix ///< +1/-1 on the block @p k, anything else
+                                 ///< elsewhere
+) {
+  /**
+   * @brief Checks the feasibility of the fixes of block @p k in @p Fix, with
+   * the complementarities of the other blocks relaxed
+   * @details The outcome is memoized in LCP::blockFeas or LCP::blockInfeas,
+   * unless the deadline is hit.
+   */
+  const unsigned long int key = this->blockFix(k, Fix);
+  if (this->blockInfeas.at(k).count(key))
+    return false;
+  if (this->blockFeas.at(k).count(key))
+    return true;
+  vector<short int> partial(this->nR, 0);
+  for (const auto i : this->Blocks.at(k))
+    partial.at(i) = Fix.at(i);
+  makeRelaxed();
+  GRBModel model(this->RlxdModel);
+  model.set(GRB_IntParam_OutputFlag, VERBOSE);
+  if (this->solvePolyFeas(model, partial)) {
+    this->blockFeas.at(k).insert(key);
+    return true;
+  }
+  if (model.get(GRB_IntAttr_Status) != GRB_TIME_LIMIT)
+    this->blockInfeas.at(k).insert(key);
+  return false;
+}
+
+Game::LCP &Game::LCP::EnumerateBlocks() {
+  /**
+   * @brief Adds every feasible polyhedron to LCP::Ai and LCP::bi, checking
+   * the feasibility block by block (see LCP::getBlocks)
+   * @details The feasible fixes of each block are enumerated on their own,
+   * and the feasible polyhedra are their combinations. Past the deadline,
+   * nothing is added.
+   */
+  const auto &blocks = this->getBlocks();
+  std::vector<std::vector<vector<short int>>> feasible(blocks.size());
+  vector<short int> Fix(this->nR, 0);
+  unsigned long int checked{0};
+  for (unsigned int k = 0; k < blocks.size(); ++k) {
+    const unsigned int nK = blocks.at(k).size();
+    for (unsigned long int e = 0; e < (1UL << nK); ++e) {
+      if (this->deadline && this->deadline->expired())
+        return *this;
+      const vector<short int> local = num_to_vec(e, nK);
+      for (unsigned int t = 0; t < nK; ++t)
+        Fix.at(blocks.at(k).at(t)) = local.at(t);
+      ++checked;
+      if (this->checkBlockFeas(k, Fix))
+        feasible.at(k).push_back(local);
+    }
+    if (feasible.at(k).empty()) {
+      BOOST_LOG_TRIVIAL(info) << "Game::LCP::EnumerateBlocks: block " << k
+                              << " has no feasible polyhedron";
+      return *this;
+    }
+  }
+  BOOST_LOG_TRIVIAL(info) << "Game::LCP::EnumerateBlocks: " << checked
+                          << " fixes checked over " << blocks.size()
+                          << " blocks";
+  // Odometer over the feasible fixes of the blocks
+  std::vector<unsigned int> choice(blocks.size(), 0);
+  while (true) {
+    for (unsigned int k = 0; k < blocks.size(); ++k)
+      for (unsigned int t = 0; t < blocks.at(k).size(); ++t)
+        Fix.at(blocks.at(k).at(t)) = feasible.at(k).at(choice.at(k)).at(t);
+    this->feasiblePoly.insert(vec_to_num(Fix));
+    this->FixToPoly(Fix, false);
+    unsigned int k{0};
+    while (k < choice.size() && ++choice.at(k) == feasible.at(k).size()) {
+      choice.at(k) = 0;
+      ++k;
+    }
+    if (k == choice.size())
+      break;
+  }
+  return *this;
+}
+
 Game::LCP &Game::LCP::EnumerateAll(
     const bool
         solveLP ///< Should the poyhedra added be checked for feasibility?
@@ -1247,7 +2058,12 @@ Game::LCP &Game::LCP::EnumerateAll(
   vector<short int> Fix = vector<short int>(nR, 0);
   this->Ai->clear();
   this->bi->clear();
-  this->FixToPolies(Fix, solveLP);
+  this->PolyOrder.clear();
+  this->OuterPolys.clear();
+  if (solveLP && this->getBlocks().size() > 1)
+    this->EnumerateBlocks();
+  else
+    this->FixToPolies(Fix, solveLP);
   if (this->Ai->empty()) {
     BOOST_LOG_TRIVIAL(warning)
         << "Empty vector of polyhedra given! Problem might be infeasible."
@@ -1340,6 +2156,121 @@ unique_ptr<GRBModel> Game::LCP::LCPasQP(bool solve)
   return model;
 }
 
+bool Game::LCP::solveLemke(
+    arma::vec &z,          ///< [out] @f$Mx+q@f$ at the solution
+    arma::vec &x,          ///< [out] The solution
+    unsigned int maxPivots ///< Maximum number of pivots. If 0, ten times the
+                           ///< number of complementarities
+) const
+/**
+ * @brief Solves the LCP with Lemke's complementary pivoting method
+ * @details Runs on a dense tableau, with a covering vector of ones, hence it
+ * is meant for small LCPs that every variable is complementary to an
+ * equation of. No MIP is built. The method gives up on ray termination, when
+ * @p maxPivots is reached (which bounds cycling under degeneracy), and when
+ * the point found violates @f$Ax \leq b@f$, since these constraints are not
+ * part of the pivoting. The LCP must then be solved with LCP::LCPasMIP.
+ * @returns true if a solution of the LCP, @f$Ax \leq b@f$ included, was found
+ */
+{
+  const unsigned int n = this->Compl.size();
+  if (n == 0 || n != this->nR || n != this->nC)
+    return false;
+  // Position in the tableau of each equation and each variable
+  std::vector<int> posOfEqn(n, -1), posOfVar(n, -1);
+  for (unsigned int k = 0; k < n; ++k) {
+    posOfEqn.at(this->Compl.at(k).first) = k;
+    posOfVar.at(this->Compl.at(k).second) = k;
+  }
+  if (std::find(posOfVar.begin(), posOfVar.end(), -1) != posOfVar.end())
+    return false;
+
+  // Columns: w (0 to n-1), then x (n to 2n-1), then the artificial variable.
+  // Row k reads w_k - M_k x - z0 = q_k
+  const unsigned int art = 2 * n;
+  arma::mat T(n, 2 * n + 1, arma::fill::zeros);
+  arma::vec rhs(n);
+  for (unsigned int k = 0; k < n; ++k) {
+    T.at(k, k) = 1;
+    T.at(k, art) = -1;
+    rhs.at(k) = this->q.at(this->Compl.at(k).first);
+  }
+  for (auto it = this->M.begin(); it != this->M.end(); ++it)
+    T.at(posOfEqn.at(it.row()), n + posOfVar.at(it.col())) = -(*it);
+  std::vector<unsigned int> basis(n);
+  std::iota(basis.begin(), basis.end(), 0);
+  const auto pivot = [&](const unsigned int r, const unsigned int c) {
+    const double p = T.at(r, c);
+    T.row(r) /= p;
+    rhs.at(r) /= p;
+    for (unsigned int i = 0; i < n; ++i) {
+      const double f = T.at(i, c);
+      if (i == r || f == 0)
+        continue;
+      T.row(i) -= f * T.row(r);
+      rhs.at(i) -= f * rhs.at(r);
+    }
+    basis.at(r) = c;
+  };
+
+  unsigned int r = 0;
+  for (unsigned int k = 1; k < n; ++k)
+    if (rhs.at(k) < rhs.at(r))
+      r = k;
+  if (rhs.at(r) < 0) {
+    if (maxPivots == 0)
+      maxPivots = 10 * n;
+    // The artificial variable enters, and makes the tableau feasible
+    pivot(r, art);
+    unsigned int entering = n + r;
+    bool done{false};
+    for (unsigned int it = 0; it < maxPivots && !done; ++it) {
+      int leavingRow{-1};
+      double best{GRB_INFINITY};
+      for (unsigned int i = 0; i < n; ++i) {
+        if (T.at(i, entering) <= this->eps_int)
+          continue;
+        const double ratio = rhs.at(i) / T.at(i, entering);
+        // On ties, the artificial variable leaves, which ends the method
+        if (ratio < best - this->eps_int ||
+            (ratio <= best + this->eps_int && basis.at(i) == art)) {
+          best = ratio;
+          leavingRow = i;
+        }
+      }
+      if (leavingRow < 0) {
+        BOOST_LOG_TRIVIAL(trace) << "Game::LCP::solveLemke: ray termination";
+        return false;
+      }
+      const unsigned int leaving = basis.at(leavingRow);
+      pivot(leavingRow, entering);
+      done = leaving == art;
+      entering = leaving < n ? leaving + n : leaving - n;
+    }
+    if (!done) {
+      BOOST_LOG_TRIVIAL(trace) << "Game::LCP::solveLemke: pivot limit reached";
+      return false;
+    }
+  }
+
+  x.zeros(this->nC);
+  for (unsigned int i = 0; i < n; ++i)
+    if (basis.at(i) >= n && basis.at(i) < art)
+      x.at(this->Compl.at(basis.at(i) - n).second) = std::max(0.0, rhs.at(i));
+  z = this->M * x + this->q;
+  for (const auto &p : this->Compl)
+    if (z.at(p.first) < -this->eps ||
+        std::min(z.at(p.first), x.at(p.second)) > this->eps)
+      return false;
+  if (this->_A.n_rows > 0) {
+    const arma::vec slack = this->_b - this->_A * x;
+    for (unsigned int i = 0; i < slack.n_elem; ++i)
+      if (slack.at(i) < -this->eps)
+        return false;
+  }
+  return true;
+}
+
 unique_ptr<GRBModel> Game::LCP::LCPasMIP(bool solve)
 /**
  * @brief Helps solving an LCP as an MIP using bigM constraints
@@ -1428,6 +2359,72 @@ Game::LCP::MPECasMIQP(const arma::sp_mat &Q, const arma::sp_mat &C,
   return model;
 }
 
+unique_ptr<GRBModel>
+Game::LCP::MPECasQP(const unsigned long int &decimalEncoding,
+                    const arma::sp_mat &Q, const arma::sp_mat &C,
+                    const arma::vec &c, const arma::vec &x_minus_i, bool solve)
+/**
+ * @brief Solves the leader's problem restricted to a single polyhedron of the
+ * LCP feasible region.
+ * @details The polyhedron is given by its decimal encoding, as in
+ * LCP::checkPolyFeas. Within a single polyhedron, the complementarity
+ * constraints are replaced by the corresponding fixings, and the MPEC reduces to
+ * a (convex) QP, or an LP if @p Q is a zero matrix. The objective is the same as
+ * the one in LCP::MPECasMIQP.
+ * @returns A unique_ptr to GRBModel that has the QP
+ */
+{
+  if (C.n_cols != x_minus_i.n_rows)
+    throw string("Game::LCP::MPECasQP: Bad size of x_minus_i");
+  if (c.n_rows != C.n_rows)
+    throw string("Game::LCP::MPECasQP: Bad size of c");
+  const vector<short int> Fix = num_to_vec(decimalEncoding, this->Compl.size());
+  makeRelaxed();
+  unique_ptr<GRBModel> model{new GRBModel(this->RlxdModel)};
+  try {
+    this->fixPoly(*model, Fix);
+    arma::vec obj = c + C * x_minus_i;
+    GRBQuadExpr expr{0};
+    for (unsigned int i = 0; i < obj.n_rows; i++)
+      expr += obj.at(i) * model->getVarByName("x_" + to_string(i));
+    for (auto it = Q.begin(); it != Q.end(); ++it)
+      expr += 0.5 * (*it) * model->getVarByName("x_" + to_string(it.row())) *
+              model->getVarByName("x_" + to_string(it.col()));
+    model->setObjective(expr, GRB_MINIMIZE);
+    model->set(GRB_IntParam_OutputFlag, VERBOSE);
+    model->update();
+    if (solve)
+      model->optimize();
+  } catch (const char *e) {
+    cerr << "Error in Game::LCP::MPECasQP: " << e << '\n';
+    throw;
+  } catch (string e) {
+    cerr << "String: Error in Game::LCP::MPECasQP: " << e << '\n';
+    throw;
+  } catch (exception &e) {
+    cerr << "Exception: Error in Game::LCP::MPECasQP: " << e.what() << '\n';
+    throw;
+  } catch (GRBException &e) {
+    cerr << "GRBException: Error in Game::LCP::MPECasQP: " << e.getErrorCode()
+         << "; " << e.getMessage() << '\n';
+    throw;
+  }
+  return model;
+}
+
+std::set<unsigned long int> Game::LCP::getFeasiblePolyCandidates() const {
+  /**
+   * Returns the decimal encoding of the polyhedra that are known to be
+   * feasible (i.e., they were checked in LCP::checkPolyFeas), but are not yet
+   * part of the inner approximation LCP::AllPolyhedra.
+   */
+  std::set<unsigned long int> candidates{};
+  std::set_difference(this->feasiblePoly.begin(), this->feasiblePoly.end(),
+                      this->AllPolyhedra.begin(), this->AllPolyhedra.end(),
+                      std::inserter(candidates, candidates.begin()));
+  return candidates;
+}
+
 void Game::LCP::write(string filename, bool append) const {
   ofstream outfile(filename, append ? ios::app : ios::out);
 
@@ -1519,9 +2516,9 @@ unsigned int Game::LCP::conv_Npoly() const {
   /**
    * To be used in interaction with Game::LCP::ConvexHull.
    * Gives the number of polyhedra in the current inner approximation of the LCP
-   * feasible region.
+   * feasible region, or in its outer approximation (see LCP::addOuterPoly).
    */
-  return this->AllPolyhedra.size();
+  return this->AllPolyhedra.size() + this->OuterPolys.size();
 }
 
 unsigned int Game::LCP::conv_PolyPosition(const unsigned long int i) const {
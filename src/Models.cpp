@@ -1,5 +1,6 @@
 // #include "models.h"
 #include "models.h"
+#include <algorithm>
 #include <armadillo>
 #include <boost/log/trivial.hpp>
 #include <boost/program_options.hpp>
@@ -692,6 +693,22 @@ Models::EPEC &Models::EPEC::addTranspCosts(
   return *this;
 }
 
+std::unique_ptr<Game::EPEC>
+Models::EPEC::makePortfolioCopy(GRBEnv *env) const {
+  /**
+   * @brief Makes a copy of the instance in @p env, for
+   * Game::EPECalgorithm::portfolio
+   * @details The copy is rebuilt from the parameters of the countries and the
+   * transportation costs, so that it shares no model with this object.
+   */
+  std::unique_ptr<Models::EPEC> copy(new Models::EPEC(env));
+  copy->quadraticTax = this->quadraticTax;
+  for (const auto &Params : this->AllLeadPars)
+    copy->addCountry(Params);
+  copy->addTranspCosts(this->TranspCosts);
+  return copy;
+}
+
 void Models::EPEC::prefinalize() {
   /**
    * Does the following:
@@ -1159,19 +1176,51 @@ void Models::EPEC::write(const string filename, bool append) const {
 }
 
 void Models::EPEC::writeSolutionJSON(string filename, const arma::vec x,
-                                     const arma::vec z) const {
+                                     const arma::vec z, bool approximate,
+                                     const std::vector<double> &regret) const {
   /**
    * @brief Writes the computed Nash Equilibrium in the standard JSON solution
    * file
    * @p filename dictates the name of the .JSON solution file
+   * If @p approximate is true, @p x is not an equilibrium (e.g., it is the
+   * best profile found before a deadline) and @p regret holds an upper bound
+   * on the regret of each country. isPureEquilibrium is then omitted, since
+   * Game::EPEC::isPureStrategy refers to the last master LCP rather than to
+   * @p x. The key z is omitted if @p z is empty, as for the best profile,
+   * which has no master LCP solution. The aggressiveness chosen at each
+   * iteration by the adaptive inner approximation, if any, is written too
+   * (see Game::EPECStatistics::aggressivenessLog)
    */
   StringBuffer s;
   PrettyWriter<StringBuffer> writer(s);
   writer.StartObject();
   writer.Key("Meta");
   writer.StartObject();
-  writer.Key("isPureEquilibrium");
-  writer.Bool(this->isPureStrategy());
+  if (!approximate) {
+    writer.Key("isPureEquilibrium");
+    writer.Bool(this->isPureStrategy());
+  }
+  writer.Key("isApproximate");
+  writer.Bool(approximate);
+  if (approximate && !regret.empty()) {
+    writer.Key("Regret");
+    writer.StartArray();
+    for (const double r : regret)
+      writer.Double(r);
+    writer.EndArray();
+  }
+  if (!this->Stats.aggressivenessLog.empty()) {
+    // One array per iteration, with the aggressiveness of each country
+    writer.Key("AggressivenessLog");
+    writer.StartArray();
+    for (const auto &levels : this->Stats.aggressivenessLog) {
+      writer.StartArray();
+      for (const unsigned int level : levels)
+        writer.Uint(level);
+      writer.EndArray();
+    }
+    writer.EndArray();
+  }
   writer.Key("nCountries");
   writer.Uint(this->getNcountries());
   writer.Key("nFollowers");
@@ -1220,11 +1269,13 @@ void Models::EPEC::writeSolutionJSON(string filename, const arma::vec x,
   for (unsigned i = 0; i < x.size(); i++)
     writer.Double(x.at(i));
   writer.EndArray();
-  writer.Key("z");
-  writer.StartArray();
-  for (unsigned i = 0; i < z.size(); i++)
-    writer.Double(z.at(i));
-  writer.EndArray();
+  if (!z.empty()) {
+    writer.Key("z");
+    writer.StartArray();
+    for (unsigned i = 0; i < z.size(); i++)
+      writer.Double(z.at(i));
+    writer.EndArray();
+  }
   writer.EndObject();
   writer.EndObject();
   ofstream file(filename + ".json");
@@ -1287,7 +1338,27 @@ void Models::EPEC::writeSolution(const int writeLevel, string filename) const {
       this->write(filename + ".txt", true);
     }
     if (writeLevel == 2 || writeLevel == 0)
-      this->writeSolutionJSON(filename, this->sol_x, this->sol_z);
+      this->writeSolutionJSON(filename, this->sol_x, this->sol_z,
+                              this->Stats.approximate,
+                              this->Stats.certifiedRegret);
+  } else if (this->Stats.status == Game::EPECsolveStatus::timeLimit &&
+             this->hasIncumbent()) {
+    // No equilibrium in time: the best profile seen is written instead
+    BOOST_LOG_TRIVIAL(warning)
+        << "Models::EPEC::writeSolution: writing the best profile found, "
+           "with regret at most "
+        << *std::max_element(this->Stats.incumbentRegret.begin(),
+                             this->Stats.incumbentRegret.end());
+    const arma::vec x = this->getIncumbent();
+    if (writeLevel == 1 || writeLevel == 2) {
+      this->WriteCountry(0, filename + ".txt", x, false);
+      for (unsigned int ell = 1; ell < this->getNcountries(); ++ell)
+        this->WriteCountry(ell, filename + ".txt", x, true);
+      this->write(filename + ".txt", true);
+    }
+    if (writeLevel == 2 || writeLevel == 0)
+      this->writeSolutionJSON(filename, x, arma::vec{}, true,
+                              this->Stats.incumbentRegret);
   } else {
     cerr << "Error in Models::EPEC::writeSolution: no solution to write."
          << '\n';
@@ -8,6 +8,8 @@
 #define EPECVERSION 0.1
 
 #include <armadillo>
+#include <atomic>
+#include <chrono>
 #include <iostream>
 #include <map>
 #include <vector>
@@ -23,6 +25,7 @@ template <class T, class S>
 std::ostream &operator<<(std::ostream &ost, std::pair<T, S> p);
 
 // Forward declarations
+class GRBModel;
 namespace Game {
 struct QP_objective;
 struct QP_constraints;
@@ -35,7 +38,36 @@ enum class EPECAddPolyMethod {
   sequential,         ///< Adds polyhedra by selecting them in order
   reverse_sequential, ///< Adds polyhedra by selecting them in reverse
                       ///< sequential order
-  random ///< Adds the next polyhedra by selecting random feasible one
+  random, ///< Adds the next polyhedra by selecting random feasible one
+  guided  ///< Adds the polyhedra whose fixes best agree with the last solution
+          ///< (see LCP::setGuidePoint)
+};
+
+/**
+ * @brief A wall-clock deadline shared by all the solver calls of a
+ * Game::EPEC
+ * @details Inactive until Deadline::set is called with a positive number of
+ * seconds. Gurobi models get the remaining time through Deadline::apply, and
+ * long loops poll Deadline::expired. Deadline::cancel expires it at once, from
+ * any thread.
+ */
+class Deadline {
+private:
+  bool active{false};
+  std::chrono::high_resolution_clock::time_point end{};
+  std::atomic<bool> cancelled{false};
+
+public:
+  void set(const double seconds);
+  void clear() { this->active = false; }
+  void cancel() noexcept { this->cancelled = true; }
+  bool isCancelled() const noexcept { return this->cancelled; }
+  bool isActive() const { return this->active || this->cancelled; }
+  double remaining() const;
+  bool expired() const {
+    return this->cancelled || (this->active && this->remaining() <= 0);
+  }
+  void apply(GRBModel &model) const;
 };
 
 } // namespace Game
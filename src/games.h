@@ -6,9 +6,13 @@
 // #include"epecsolve.h"
 #include "lcptolp.h"
 #include <armadillo>
+#include <atomic>
 #include <gurobi_c++.h>
 #include <iostream>
+#include <list>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 
@@ -186,9 +190,14 @@ public: // Constructors
   QP_Param(const QP_Param &Qu)
       : MP_Param(Qu), env{Qu.env}, QuadModel{Qu.QuadModel}, made_yQy{
                                                                 Qu.made_yQy} {
+    this->deadline = Qu.deadline;
     this->size();
   };
 
+  const Deadline *deadline{
+      nullptr}; ///< If not null, QP_Param::solveFixed is limited to the time
+                ///< left
+
   // Override setters
   QP_Param &set(const arma::sp_mat &Q, const arma::sp_mat &C,
                 const arma::sp_mat &A, const arma::sp_mat &B,
@@ -410,15 +419,32 @@ enum class EPECalgorithm {
                       ///< followers
   innerApproximation, ///< Perfrorm increasingly better inner approximations in
   ///< iterations
-  combinatorialPNE ///< Perform a combinatorial-based search strategy to find a
-                   ///< pure NE
+  combinatorialPNE, ///< Perform a combinatorial-based search strategy to find
+                    ///< a pure NE
+  outerApproximation, ///< Branch on the complementarities violated on outer
+                      ///< approximations of the feasible regions
+  bestResponseDynamics, ///< Let the countries best respond to each other, one
+                        ///< polyhedron each, until no one deviates (see
+                        ///< EPECAlgorithmParams::dynamics)
+  portfolio ///< Race several configurations concurrently, and keep the first
+            ///< one that settles the instance (see EPEC::setPortfolio)
+};
+
+///< Update schemes of EPECalgorithm::bestResponseDynamics
+enum class EPECDynamics {
+  gaussSeidel, ///< One country switches to its best response at a time
+  jacobi       ///< All the countries switch to their best responses at once,
+               ///< computed concurrently
 };
 
 ///< Recovery strategies for obtaining a PNE with innerApproximation
 enum class EPECRecoverStrategy {
   incrementalEnumeration, ///< Add random polyhedra in each iteration
-  combinatorial ///< Triggers the combinatorialPNE with additional information
-                ///< from innerApproximation
+  combinatorial, ///< Triggers the combinatorialPNE with additional information
+                 ///< from innerApproximation
+  supportReduction ///< Searches the combinations of polyhedra in the support
+                   ///< of the mixed NE, and their neighbours, before
+                   ///< triggering the combinatorialPNE
 };
 
 /// @brief Stores the configuration for EPEC algorithms
@@ -446,6 +472,68 @@ struct EPECAlgorithmParams {
   bool pureNE{false}; ///< If true, the algorithm will tend to search for pure
                       ///< NE. If none exists, it will return a MNE (if exists)
   double solvedTol{0.01};
+  bool twoPhaseResponse{
+      false}; ///< If true, best responses are first sought over the known
+              ///< feasible polyhedra that are not yet in the inner
+              ///< approximation, and the full MPEC is solved only if none of
+              ///< them yields a profitable deviation.
+  unsigned int devnPoolSize{
+      1}; ///< Maximum number of improving solutions harvested from the solution
+          ///< pool of each best response in EPEC::iterativeNash. If 1, only the
+          ///< optimal response is used.
+  unsigned int masterPoolSize{
+      1}; ///< Maximum number of solutions kept in the solution pool of the
+          ///< master LCP in EPEC::iterativeNash. Deviations are computed from
+          ///< each of the solutions with a distinct support found by Gurobi
+          ///< while solving the master (best effort, no systematic search of
+          ///< the pool). If 1, only the master solution is used.
+  bool pipelined{false}; ///< If true, EPEC::iterativeNash runs the best
+                         ///< response, the polyhedra addition and the convex
+                         ///< hull of each country as a concurrent task, each
+                         ///< in its own Gurobi environment. Must be set before
+                         ///< EPEC::finalize
+  bool masterMIPStart{false}; ///< If true, the solution of the previous
+                              ///< master LCP is mapped onto the new one and
+                              ///< given to Gurobi as a (partial) MIP start
+  bool combinatorialPruning{
+      false}; ///< If true, EPEC::combinatorialPNE prunes partial
+              ///< combinations of polyhedra that cannot lead to a pure NE
+  unsigned int hullCacheSize{
+      0}; ///< Maximum number of convex hulls memoized per country by
+          ///< EPEC::make_country_QP. 0 disables the cache. The cap counts
+          ///< entries, not bytes: each entry holds a full copy of the hull
+          ///< QP, whose size grows with the number of polyhedra
+  unsigned int neighbourExpansion{
+      0}; ///< Maximum number of polyhedra at Hamming distance 1 from the
+          ///< support and the deviations added per country and iteration of
+          ///< EPEC::iterativeNash. 0 disables the expansion
+  bool adaptiveAggressiveness{
+      false}; ///< If true, EPEC::iterativeNash tunes the aggressiveness of
+              ///< each country at run time, starting from aggressiveness
+  double continuationStart{
+      1}; ///< If greater than 1, EPEC::iterativeNash starts with solvedTol and
+          ///< the MIP gaps loosened by this factor, and tightens them tenfold
+          ///< after each master LCP that yields an equilibrium. The configured
+          ///< values are always restored to certify the final equilibrium
+  double epsilon{
+      -1}; ///< If positive, EPEC::iterativeNash stops as soon as the regret of
+           ///< every country is certified to be at most this value, i.e., at
+           ///< an epsilon-Nash equilibrium
+  unsigned int disjunctiveCuts{
+      0}; ///< Maximum number of disjunctive cuts in the pool of each country
+          ///< in EPEC::outerApproximationNash. 0 disables the cuts
+  unsigned int masterDecomposition{
+      0}; ///< Maximum number of rounds of price coordination across the
+          ///< countries tried by EPEC::computeNashEq before solving the master
+          ///< LCP as one MIP (see EPEC::decomposedNashEq). 0 disables the
+          ///< decomposition
+  Game::EPECDynamics dynamics =
+      Game::EPECDynamics::gaussSeidel; ///< Update scheme of
+                                       ///< EPEC::bestResponseDynamicsNash
+  unsigned int dynamicsRounds{
+      50}; ///< Maximum number of profiles visited by
+           ///< EPEC::bestResponseDynamicsNash before handing over to
+           ///< EPEC::iterativeNash. 0 means no limit
 };
 
 /// @brief Stores statistics for a (solved) EPEC instance
@@ -467,6 +555,50 @@ struct EPECStatistics {
           ///< leader (country)
   double wallClockTime = {0};
   bool pureNE{false}; ///< True if the equilibrium is a pure NE.
+  std::vector<unsigned int> knownPolyDevns =
+      {}; ///< Number of deviations found in a known polyhedron by the first
+          ///< phase of EPECAlgorithmParams::twoPhaseResponse, indexed by
+          ///< country
+  std::vector<unsigned int> pooledDevns =
+      {}; ///< Number of improving deviations harvested from the best response
+          ///< pools (see EPECAlgorithmParams::devnPoolSize), indexed by
+          ///< country
+  int masterPoolSolutions{0}; ///< Number of further master solutions, with a
+                             ///< distinct support, whose deviations were
+                             ///< computed (see
+                             ///< EPECAlgorithmParams::masterPoolSize)
+  int masterStarts{0}; ///< Number of master LCPs given a MIP start
+  int masterStartsAccepted{0}; ///< Number of those MIP starts Gurobi turned
+                               ///< into an incumbent
+  int decomposedMasters{0}; ///< Number of master LCPs solved by price
+                            ///< coordination (see
+                            ///< EPECAlgorithmParams::masterDecomposition)
+  unsigned int prunedCombinations{
+      0}; ///< Number of partial combinations pruned by EPEC::combinatorialPNE
+          ///< (see EPECAlgorithmParams::combinatorialPruning)
+  unsigned int evaluatedCombinations{
+      0}; ///< Number of full combinations checked by EPEC::combinatorialPNE
+  std::vector<unsigned int> hullCacheHits =
+      {}; ///< Number of convex hulls reused from the cache, indexed by country
+  std::vector<unsigned int> hullCacheMisses =
+      {}; ///< Number of convex hulls computed and cached, indexed by country
+  std::vector<double> certifiedRegret =
+      {}; ///< Upper bound on the regret of each country at the last point
+          ///< checked with EPECAlgorithmParams::epsilon. GRB_INFINITY if
+          ///< not certified
+  std::vector<unsigned int> cutPoolSize =
+      {}; ///< Number of disjunctive cuts in the pool of each country (see
+          ///< EPECAlgorithmParams::disjunctiveCuts)
+  int portfolioWinner{-1}; ///< Index of the configuration that won
+                           ///< EPECalgorithm::portfolio, -1 if none did
+  std::vector<std::vector<unsigned int>> aggressivenessLog =
+      {}; ///< Aggressiveness of each country, every time random polyhedra
+          ///< are added with EPECAlgorithmParams::adaptiveAggressiveness
+  std::vector<double> incumbentRegret =
+      {}; ///< Regret of each country at the incumbent, i.e., the profile with
+          ///< the lowest maximum regret seen so far. Empty if none was measured
+  bool approximate{false}; ///< True if the solution is an epsilon-NE only
+                           ///< (see EPECAlgorithmParams::epsilon)
   EPECAlgorithmParams AlgorithmParam =
       {}; ///< Stores the configuration for the EPEC algorithm employed in the
           ///< instance.
@@ -475,13 +607,23 @@ struct EPECStatistics {
 ///@brief Class to handle a Nash game between leaders of Stackelberg games
 class EPEC {
 private:
+  std::vector<std::unique_ptr<GRBEnv>>
+      portfolioEnvs{}; ///< Environments of the models taken over from the
+                       ///< winner of EPECalgorithm::portfolio. Declared
+                       ///< first, so that they are destroyed last
+  std::vector<EPECAlgorithmParams>
+      portfolioConfigs{}; ///< The configurations raced by
+                          ///< EPECalgorithm::portfolio
+  bool racing{false}; ///< True for the copies raced by
+                      ///< EPECalgorithm::portfolio, which write no debug file
   std::vector<unsigned int> SizesWithoutHull{};
   Game::EPECalgorithm algorithm =
       Game::EPECalgorithm::fullEnumeration; ///< Stores the type of algorithm
   ///< used by the EPEC.
   std::unique_ptr<Game::LCP> lcp; ///< The EPEC nash game written as an LCP
   std::unique_ptr<GRBModel>
-      lcpmodel; ///< A Gurobi mode object of the LCP form of EPEC
+      lcpmodel; ///< A Gurobi mode object of the LCP form of EPEC. Not made
+                ///< when EPEC::decomposedNashEq solves the master
   std::unique_ptr<GRBModel>
       lcpmodel_base; ///< A Gurobi mode object of the LCP form of EPEC. If
                      ///< we are searching for a pure NE,
@@ -490,8 +632,52 @@ private:
   unsigned int nVarinEPEC{0};
   unsigned int nCountr{0};
   bool warmStarted{false}; ///< Flag that checks if warmstarting is done.
+  std::vector<arma::vec>
+      startLeadFoll{}; ///< For each country, its variables in the last master
+                       ///< solution
+  std::vector<std::map<unsigned long int, std::pair<double, arma::vec>>>
+      startPolySol{}; ///< For each country and each polyhedron (decimal
+                      ///< encoding) in the last master solution, its weight
+                      ///< and its convex hull variables
+  /// @brief A convex hull memoized by EPEC::make_country_QP
+  struct HullCacheEntry {
+    std::vector<unsigned long int> polyhedra; ///< As in LCP::getPolyOrder
+    std::shared_ptr<Game::QP_Param> QP;       ///< Before any EPEC::addDummy
+    std::shared_ptr<Game::QP_objective> objective;
+    unsigned int feasiblePolyhedra;
+  };
+  std::vector<std::list<HullCacheEntry>>
+      hullCache{}; ///< For each country, its memoized convex hulls, the most
+                   ///< recently used first
+  std::vector<unsigned int>
+      countryAggressiveness{}; ///< Current aggressiveness of each country,
+                               ///< see EPEC::updateAggressiveness
+  unsigned int commonAggressiveness{
+      0}; ///< Level the country values are scaled from, 0 before the first
+          ///< call to EPEC::updateAggressiveness
+  double continuationFactor{1}; ///< Current loosening of solvedTol and of the
+                                ///< MIP gaps, see continuationStart
+  arma::vec decompositionPrices{}; ///< Market clearing prices of the last
+                                   ///< round of EPEC::decomposedNashEq
+  double lastMasterTime{-1}; ///< Seconds spent on the last master LCP
+  double lastHullTime{-1};   ///< Seconds spent on the last convex hulls
+  std::vector<arma::vec>
+      incumbentLeadFoll{}; ///< Each country's variables at the incumbent, see
+                           ///< EPECStatistics::incumbentRegret
+  arma::vec incumbentMC{}; ///< Market clearing variables at the incumbent
+  mutable std::mutex incumbentMutex; ///< Guards the incumbent
+  static std::atomic<bool> stopFlag; ///< Set by EPEC::requestStop. Sticky:
+                                     ///< only EPEC::clearStop resets it
 
 protected: // Datafields
+  std::vector<std::unique_ptr<GRBEnv>>
+      countryEnvs{}; ///< One Gurobi environment per country, made in
+                     ///< EPEC::finalize only if
+                     ///< EPECAlgorithmParams::pipelined is true
+  std::vector<std::unique_ptr<GRBEnv>>
+      polyFeasEnvs{}; ///< Gurobi environments of the workers checking the
+                      ///< feasibility of polyhedra in batches, made on first
+                      ///< use by EPEC::expandNeighbourPolys
   std::vector<std::shared_ptr<Game::NashGame>> countries_LL{};
   std::vector<std::unique_ptr<Game::LCP>> countries_LCP{};
 
@@ -517,10 +703,15 @@ protected: // Datafields
   GRBEnv *env;
   bool finalized{false};
   bool nashEq{false};
-  std::chrono::high_resolution_clock::time_point initTime;
+  Game::Deadline deadline{}; ///< Set from EPECAlgorithmParams::timeLimit by
+                             ///< EPEC::findNashEq, and shared by all the
+                             ///< solver calls
   EPECStatistics Stats{};            ///< Store run time information
   arma::vec sol_z,                   ///< Solution equation values
       sol_x;                         ///< Solution variable values
+  std::vector<arma::vec>
+      masterPoolSols{}; ///< Other solutions of the master LCP, with a support
+                        ///< distinct from the one of sol_x
   bool warmstart(const arma::vec x); ///< Warmstarts EPEC with a solution
 
 private:
@@ -528,28 +719,112 @@ private:
   add_Dummy_Lead(const unsigned int i); ///< Add Dummy variables for the leaders
   void make_country_QP(const unsigned int i);
   void make_country_QP();
-  void make_country_LCP();
+  void updateConvexHullLocs();
+  void make_country_LCP(bool makeModel = true);
   virtual GRBQuadExpr make_lcp_objective(GRBModel *);
   void resetLCP();
   void iterativeNash();
   void fullEnumerationNash();
+  bool decoupledNash();
+  void outerApproximationNash();
+  void bestResponseDynamicsNash();
+  void dynamicsResponses(const std::vector<unsigned int> &players,
+                         std::vector<double> &vals,
+                         std::vector<double> &bounds,
+                         std::vector<unsigned long int> &polys,
+                         bool &infeasible);
   void combinatorial_pure_NE(
       const std::vector<long int> combination,
-      const std::vector<std::set<unsigned long int>> &excludeList);
+      const std::vector<std::set<unsigned long int>> &excludeList,
+      const std::vector<std::vector<long int>> &candidates = {});
+  bool supportReductionPNE();
+  std::unique_ptr<Game::NashGame>
+  makeWorkerNashGame(const std::vector<std::shared_ptr<Game::QP_Param>> &QPs,
+                     const arma::sp_mat &MC, const arma::vec &MCRHS,
+                     GRBEnv *workerEnv) const;
+  bool isPartialCombinationFeasible(
+      const std::vector<std::shared_ptr<Game::QP_Param>> &QPs,
+      const arma::sp_mat &MC, const arma::vec &MCRHS, GRBEnv *workerEnv,
+      double localTimeLimit = -1.0) const;
+  bool isPureNECombination(
+      const std::vector<std::shared_ptr<Game::QP_Param>> &QPs,
+      const arma::sp_mat &MC, const arma::vec &MCRHS, GRBEnv *workerEnv,
+      const std::vector<std::unique_ptr<Game::LCP>> &workerLCP,
+      const std::vector<long int> &combination,
+      const std::vector<std::vector<long int>> &screenPolys,
+      std::vector<long int> &lastDevn, double localTimeLimit = -1.0);
+  bool
+  screenCombination(const arma::vec &x, const arma::vec &objvals,
+                    const std::vector<long int> &combination,
+                    const std::vector<std::vector<long int>> &screenPolys,
+                    const std::vector<std::unique_ptr<Game::LCP>> &workerLCP,
+                    std::vector<long int> &lastDevn) const;
+  std::vector<long int> orderCombinatorialPolys(const unsigned int i,
+                                                std::vector<long int> polys,
+                                                const arma::vec &x) const;
   void combinatorialPNE(
       const std::vector<long int> combination = {},
       const std::vector<std::set<unsigned long int>> &excludeList = {});
+  void portfolioNash();
+  std::vector<EPECAlgorithmParams> getPortfolioConfigs() const;
+  void adoptPortfolioRun(Game::EPEC &run, bool solution);
   void make_pure_LCP(bool indicators = false);
   void computeLeaderLocations(const unsigned int addSpaceForMC = 0);
 
   bool getAllDevns(std::vector<arma::vec> &devns, const arma::vec &guessSol,
-                   const std::vector<arma::vec> &prevDev = {}) const;
-  unsigned int addDeviatedPolyhedron(const std::vector<arma::vec> &devns,
-                                     bool &infeasCheck) const;
+                   const std::vector<arma::vec> &prevDev = {},
+                   std::vector<long int> *devnPoly = nullptr,
+                   std::vector<std::vector<arma::vec>> *devnPool = nullptr,
+                   std::vector<double> *regrets = nullptr,
+                   const std::vector<arma::vec> &knownDevns = {}) const;
+  bool getCountryDevn(arma::vec &devn, const unsigned int i,
+                      const arma::vec &guessSol, const arma::vec &objvals,
+                      const arma::vec &prevDev, long int *poly = nullptr,
+                      std::vector<arma::vec> *pool = nullptr,
+                      double *regret = nullptr,
+                      const arma::vec &knownDevn = {}) const;
+  unsigned int addDeviatedPolyhedron(
+      const std::vector<arma::vec> &devns, bool &infeasCheck,
+      const std::vector<long int> &devnPoly = {},
+      const std::vector<std::vector<arma::vec>> &devnPool = {}) const;
+  bool addDeviatedPolyhedron(const unsigned int i, const arma::vec &devn,
+                             const long int poly,
+                             const std::vector<arma::vec> &pool,
+                             unsigned int &added) const;
+  void updateAggressiveness();
+  double currentSolvedTol() const;
+  double certifyRegret(std::vector<arma::vec> *devns = nullptr);
+  double currentMIPGap() const;
+  unsigned int expandNeighbourPolys(
+      const std::vector<arma::vec> &devns,
+      const std::vector<std::vector<unsigned long int>> &support);
+  std::vector<std::vector<unsigned long int>> getSupportPolys() const;
+  unsigned int pipelinedDevns(std::vector<arma::vec> &devns,
+                              const std::vector<arma::vec> &prevDevns,
+                              bool &infeasCheck,
+                              std::vector<double> *regrets = nullptr,
+                              const std::vector<arma::vec> &knownDevns = {});
+  std::vector<arma::vec> getLeadFoll(const arma::vec &x, arma::vec &MC) const;
+  void updateIncumbent(const std::vector<arma::vec> &leadFoll,
+                       const arma::vec &MC, const std::vector<double> &regret);
+  double incumbentMaxRegret() const;
+  GRBEnv *getCountryEnv(const unsigned int i) const;
+  void harvestDevnPool(GRBModel *model, unsigned int player,
+                       const double threshold,
+                       std::vector<arma::vec> &pool) const;
+  double RespondKnownPoly(arma::vec &sol, unsigned int player,
+                          const arma::vec &x, const double currentObj,
+                          long int &poly) const;
   void get_x_minus_i(const arma::vec &x, const unsigned int &i,
                      arma::vec &solOther) const;
+  std::vector<std::vector<unsigned int>>
+  getSupport(const arma::vec &x, const double tol = 1e-5) const;
   bool computeNashEq(bool pureNE = false, double localTimeLimit = -1.0,
                      bool check = false);
+  void saveMasterStart();
+  bool decomposedNashEq();
+  bool setMasterStart(std::vector<GRBVar> &startVars,
+                      std::vector<double> &startVals);
   bool addRandomPoly2All(unsigned int aggressiveLevel = 1,
                          bool stopOnSingleInfeasibility = false);
 
@@ -567,6 +842,7 @@ protected: // functions
   virtual void
   updateLocs() = 0; // If any location tracking system is implemented, that can
                     // be called from in here.
+  virtual std::unique_ptr<Game::EPEC> makePortfolioCopy(GRBEnv *env) const;
   virtual void make_MC_cons(arma::sp_mat &MC, arma::vec &RHS) const {
     MC.zeros();
     RHS.zeros();
@@ -586,15 +862,31 @@ public:                  // functions
   void finalize();
   void findNashEq();
 
-  std::unique_ptr<GRBModel> Respond(const unsigned int i,
-                                    const arma::vec &x) const;
+  std::unique_ptr<GRBModel> Respond(const unsigned int i, const arma::vec &x,
+                                    bool solve = true,
+                                    Game::LCP *lcp = nullptr) const;
   double RespondSol(arma::vec &sol, unsigned int player, const arma::vec &x,
-                    const arma::vec &prevDev) const;
+                    const arma::vec &prevDev,
+                    std::vector<arma::vec> *pool = nullptr,
+                    double poolThreshold = GRB_INFINITY,
+                    double *bound = nullptr) const;
   bool isSolved(unsigned int *countryNumber, arma::vec *ProfDevn,
                 double tol = 51e-4) const;
 
   bool isSolved(double tol = 51e-4) const;
 
+  ///@brief Asks any running Game::EPEC::findNashEq to stop as soon as
+  /// possible, as on a time limit. Safe to call from a signal handler
+  /// @details The request is shared by all the objects and stays in place,
+  /// so that any later Game::EPEC::findNashEq stops at once as well, until
+  /// Game::EPEC::clearStop is called
+  static void requestStop() noexcept { EPEC::stopFlag = true; }
+  ///@brief Withdraws a request made with Game::EPEC::requestStop
+  static void clearStop() noexcept { EPEC::stopFlag = false; }
+  static bool stopRequested() noexcept { return EPEC::stopFlag; }
+  bool hasIncumbent() const;
+  arma::vec getIncumbent() const;
+
   const arma::vec getx() const { return this->sol_x; }
   void reset() { this->sol_x.ones(); }
   const arma::vec getz() const { return this->sol_z; }
@@ -624,6 +916,95 @@ public:                  // functions
   inline double getSolvedTol() const {
     return this->Stats.AlgorithmParam.solvedTol;
   }
+  void setTwoPhaseResponse(bool val) {
+    this->Stats.AlgorithmParam.twoPhaseResponse = val;
+  }
+  bool getTwoPhaseResponse() const {
+    return this->Stats.AlgorithmParam.twoPhaseResponse;
+  }
+  void setDisjunctiveCuts(unsigned int k) {
+    this->Stats.AlgorithmParam.disjunctiveCuts = k;
+  }
+  unsigned int getDisjunctiveCuts() const {
+    return this->Stats.AlgorithmParam.disjunctiveCuts;
+  }
+  void setMasterDecomposition(unsigned int k) {
+    this->Stats.AlgorithmParam.masterDecomposition = k;
+  }
+  unsigned int getMasterDecomposition() const {
+    return this->Stats.AlgorithmParam.masterDecomposition;
+  }
+  void setDynamics(Game::EPECDynamics val) {
+    this->Stats.AlgorithmParam.dynamics = val;
+  }
+  Game::EPECDynamics getDynamics() const {
+    return this->Stats.AlgorithmParam.dynamics;
+  }
+  void setDynamicsRounds(unsigned int k) {
+    this->Stats.AlgorithmParam.dynamicsRounds = k;
+  }
+  unsigned int getDynamicsRounds() const {
+    return this->Stats.AlgorithmParam.dynamicsRounds;
+  }
+  void setDevnPoolSize(unsigned int k) {
+    this->Stats.AlgorithmParam.devnPoolSize = k;
+  }
+  unsigned int getDevnPoolSize() const {
+    return this->Stats.AlgorithmParam.devnPoolSize;
+  }
+  void setMasterPoolSize(unsigned int k) {
+    this->Stats.AlgorithmParam.masterPoolSize = k;
+  }
+  unsigned int getMasterPoolSize() const {
+    return this->Stats.AlgorithmParam.masterPoolSize;
+  }
+  void setPipelined(bool val) {
+    this->Stats.AlgorithmParam.pipelined = val;
+  }
+  bool getPipelined() const { return this->Stats.AlgorithmParam.pipelined; }
+  void setMasterMIPStart(bool val) {
+    this->Stats.AlgorithmParam.masterMIPStart = val;
+  }
+  bool getMasterMIPStart() const {
+    return this->Stats.AlgorithmParam.masterMIPStart;
+  }
+  void setCombinatorialPruning(bool val) {
+    this->Stats.AlgorithmParam.combinatorialPruning = val;
+  }
+  bool getCombinatorialPruning() const {
+    return this->Stats.AlgorithmParam.combinatorialPruning;
+  }
+  void setHullCacheSize(unsigned int val) {
+    this->Stats.AlgorithmParam.hullCacheSize = val;
+  }
+  unsigned int getHullCacheSize() const {
+    return this->Stats.AlgorithmParam.hullCacheSize;
+  }
+  void setEpsilon(double val) { this->Stats.AlgorithmParam.epsilon = val; }
+  double getEpsilon() const { return this->Stats.AlgorithmParam.epsilon; }
+  void setContinuationStart(double val) {
+    this->Stats.AlgorithmParam.continuationStart = val;
+  }
+  double getContinuationStart() const {
+    return this->Stats.AlgorithmParam.continuationStart;
+  }
+  void setAdaptiveAggressiveness(bool val) {
+    this->Stats.AlgorithmParam.adaptiveAggressiveness = val;
+  }
+  bool getAdaptiveAggressiveness() const {
+    return this->Stats.AlgorithmParam.adaptiveAggressiveness;
+  }
+  void setNeighbourExpansion(unsigned int val) {
+    this->Stats.AlgorithmParam.neighbourExpansion = val;
+  }
+  unsigned int getNeighbourExpansion() const {
+    return this->Stats.AlgorithmParam.neighbourExpansion;
+  }
+  ///@brief Sets the configurations raced by EPECalgorithm::portfolio. If
+  /// empty, a default portfolio is used
+  void setPortfolio(const std::vector<EPECAlgorithmParams> &configs) {
+    this->portfolioConfigs = configs;
+  }
   unsigned int getNumThreads() const {
     return this->Stats.AlgorithmParam.threads;
   }
@@ -703,6 +1084,9 @@ public:                  // functions
   /// Writes the GRBModel solved in the last iteration to solve the problem or
   /// to prove non-existence of Nash equilibrium to a file.
   void writeLcpModel(std::string filename) const {
+    if (!this->lcpmodel)
+      throw std::string("Error in Game::EPEC::writeLcpModel: the master LCP "
+                        "was solved without a GRBModel");
     this->lcpmodel->write(filename);
   }
 };
@@ -714,6 +1098,7 @@ string to_string(const Game::EPECalgorithm al);
 string to_string(const Game::EPECRecoverStrategy st);
 string to_string(const Game::EPECAlgorithmParams al);
 string to_string(const Game::EPECAddPolyMethod add);
+string to_string(const Game::EPECDynamics dyn);
 }; // namespace std
 
 /* Example for QP_Param */
@@ -6,9 +6,11 @@
 
 #include "epecsolve.h"
 #include <armadillo>
+#include <functional>
 #include <gurobi_c++.h>
 #include <iostream>
 #include <memory>
+#include <queue>
 #include <set>
 
 // using namespace Game;
@@ -16,7 +18,8 @@
 namespace Game {
 
 arma::vec LPSolve(const arma::sp_mat &A, const arma::vec &b, const arma::vec &c,
-                  int &status, bool Positivity = false);
+                  int &status, bool Positivity = false,
+                  const Deadline *deadline = nullptr);
 
 unsigned int ConvexHull(const std::vector<arma::sp_mat *> *Ai,
                         const std::vector<arma::vec *> *bi, arma::sp_mat &A,
@@ -64,11 +67,39 @@ private:
   /// inequalities are fixed to equality to get the individual polyhedra
   std::set<unsigned long int> AllPolyhedra =
       {}; ///< Decimal encoding of polyhedra that have been enumerated
+  std::vector<unsigned long int> PolyOrder =
+      {}; ///< Decimal encoding of the polyhedra in LCP::Ai, in the same order
   std::set<unsigned long int> feasiblePoly =
       {}; ///< Decimal encoding of polyhedra that have been enumerated
   std::set<unsigned long int> knownInfeas =
       {}; ///< Decimal encoding of polyhedra known to be infeasible
+  std::vector<std::vector<short int>>
+      OuterPolys{}; ///< Encoding of the polyhedra of the outer approximation
+                    ///< in LCP::Ai, in the same order. 0 marks a relaxed
+                    ///< complementarity
   unsigned long int maxTheoreticalPoly{0};
+  std::vector<short int>
+      guidedBase{}; ///< Best agreeing encoding, see LCP::setGuidePoint
+  std::vector<double> guidedDelta{}; ///< Cost of flipping each fix, ascending
+  std::vector<unsigned int>
+      guidedOrder{}; ///< Index in LCP::guidedBase of each LCP::guidedDelta
+  /// Cost of a set of flipped fixes, and the set
+  typedef std::pair<double, std::vector<unsigned int>> guidedNode;
+  std::priority_queue<guidedNode, std::vector<guidedNode>,
+                      std::greater<guidedNode>>
+      guidedHeap{}; ///< Sets of flipped fixes yet to be tried, by cost
+  std::vector<std::vector<unsigned int>>
+      Blocks{}; ///< Complementarities (equation indices) of each independent
+                ///< block, see LCP::getBlocks. Empty until computed
+  std::vector<std::set<unsigned long int>>
+      blockFeas{}; ///< For each block, the encodings of its own fixes (see
+                   ///< LCP::blockFix) known to be feasible
+  std::vector<std::set<unsigned long int>>
+      blockInfeas{}; ///< For each block, the encodings of its own fixes known
+                     ///< to be infeasible
+  arma::sp_mat CutsA{}; ///< LHS of the pool of cuts valid for the whole
+                        ///< feasible region, see LCP::addDisjunctiveCut
+  arma::vec Cutsb{};    ///< RHS of the pool of cuts
   std::unique_ptr<spmat_Vec>
       Ai; ///< Vector to contain the LHS of inner approx polyhedra
   std::unique_ptr<vec_Vec>
@@ -110,6 +141,15 @@ private:
                    bool custom = false, spmat_Vec *custAi = {},
                    vec_Vec *custbi = {});
   unsigned long int getNextPoly(Game::EPECAddPolyMethod method);
+  void fixPoly(GRBModel &model, const std::vector<short int> &Fix) const;
+  bool solvePolyFeas(GRBModel &model, const std::vector<short int> &Fix) const;
+  void polyFromFix(const std::vector<short int> &Fix, arma::sp_mat &A,
+                   arma::vec &b) const;
+  unsigned long int blockFix(const unsigned int k,
+                             const std::vector<short int> &Fix) const;
+  int blockVerdict(const std::vector<short int> &Fix) const;
+  bool checkBlockFeas(const unsigned int k, const std::vector<short int> &Fix);
+  LCP &EnumerateBlocks();
 
 public:
   // Fudgible data
@@ -124,6 +164,9 @@ public:
   long int addPolyMethodSeed = {
       -1}; ///< Seeds the random generator for the random polyhedra selection.
            ///< Should be a positive value
+  const Deadline *deadline{
+      nullptr}; ///< If not null, every model made by this object is limited
+                ///< to the time left, and enumerations stop when it expires
 
   /** Constructors */
   /// Class has no default constructors
@@ -170,11 +213,12 @@ public:
   inline unsigned int getNrow() { return this->M.n_rows; };
 
   bool extractSols(GRBModel *model, arma::vec &z, arma::vec &x,
-                   bool extractZ = false) const;
+                   bool extractZ = false, int solNumber = -1) const;
 
   /* Getting single point solutions */
   std::unique_ptr<GRBModel> LCPasQP(bool solve = false);
   std::unique_ptr<GRBModel> LCPasMIP(bool solve = false);
+  bool solveLemke(arma::vec &z, arma::vec &x, unsigned int maxPivots = 0) const;
   std::unique_ptr<GRBModel> MPECasMILP(const arma::sp_mat &C,
                                        const arma::vec &c,
                                        const arma::vec &x_minus_i,
@@ -182,8 +226,13 @@ public:
   std::unique_ptr<GRBModel>
   MPECasMIQP(const arma::sp_mat &Q, const arma::sp_mat &C, const arma::vec &c,
              const arma::vec &x_minus_i, bool solve = false);
+  std::unique_ptr<GRBModel>
+  MPECasQP(const unsigned long int &decimalEncoding, const arma::sp_mat &Q,
+           const arma::sp_mat &C, const arma::vec &c,
+           const arma::vec &x_minus_i, bool solve = false);
   /* Convex hull computation */
   unsigned int ConvexHull(arma::sp_mat &A, arma::vec &b);
+  void commonConstraints(arma::sp_mat &A, arma::vec &b) const;
   unsigned int conv_Npoly() const;
   unsigned int conv_PolyPosition(const unsigned long int i) const;
   unsigned int conv_PolyWt(const unsigned long int i) const;
@@ -191,9 +240,18 @@ public:
   std::set<unsigned long int> getAllPolyhedra() const {
     return this->AllPolyhedra;
   };
+  /// Decimal encoding of the polyhedra, in the order of their convex hull
+  /// variables (see LCP::conv_PolyPosition)
+  const std::vector<unsigned long int> &getPolyOrder() const {
+    return this->PolyOrder;
+  };
   unsigned long int getNumTheoreticalPoly() const noexcept {
     return this->maxTheoreticalPoly;
   }
+  unsigned long int getNumKnownInfeas() const noexcept {
+    return this->knownInfeas.size();
+  }
+  std::set<unsigned long int> getFeasiblePolyCandidates() const;
 
   LCP &makeQP(Game::QP_objective &QP_obj, Game::QP_Param &QP);
 
@@ -202,15 +260,42 @@ public:
            Game::EPECAddPolyMethod method = Game::EPECAddPolyMethod::sequential,
            std::set<std::vector<short int>> Polys = {});
   bool addThePoly(const unsigned long int &decimalEncoding);
+  void setGuidePoint(const arma::vec &x);
   bool checkPolyFeas(const unsigned long int &decimalEncoding);
   bool checkPolyFeas(const std::vector<short int> &Fix);
+  std::vector<unsigned long int>
+  checkPolyFeas(const std::vector<unsigned long int> &polys,
+                const std::vector<GRBEnv *> &envs);
+  std::vector<unsigned long int>
+  getNeighbourPolys(const arma::vec &x,
+                    const std::vector<unsigned long int> &polys) const;
   void clearPolyhedra() {
     this->Ai->clear();
     this->bi->clear();
     this->AllPolyhedra.clear();
+    this->PolyOrder.clear();
+    this->OuterPolys.clear();
+  }
+  bool addOuterPoly(const std::vector<short int> &Fix, bool checkFeas = true);
+  unsigned int branchOuterPoly(const unsigned int k, const unsigned int pair);
+  /// Encoding of the polyhedra of the outer approximation, in the order of
+  /// their convex hull variables
+  const std::vector<std::vector<short int>> &getOuterPolys() const {
+    return this->OuterPolys;
+  }
+  long int mostViolatedCompl(const arma::vec &x, double &violation) const;
+  bool addDisjunctiveCut(const arma::vec &x, const unsigned int pair);
+  unsigned int getNumCuts() const { return this->Cutsb.n_elem; }
+  /// Empties the pool of cuts. LCP::clearPolyhedra keeps it, since the cuts
+  /// are valid for the whole feasible region
+  void clearCuts() {
+    this->CutsA.reset();
+    this->Cutsb.reset();
   }
   LCP &addPolyFromX(const arma::vec &x, bool &ret);
+  unsigned long int polyFromX(const arma::vec &x) const;
   LCP &EnumerateAll(bool solveLP = true);
+  const std::vector<std::vector<unsigned int>> &getBlocks();
   std::string feas_detail_str() const;
   unsigned int getFeasiblePolyhedra() const { return this->feasiblePolyhedra; }
   void write(std::string filename, bool append = true) const;
@@ -233,6 +233,8 @@ private:
 
   void make_MC_cons(arma::sp_mat &MCLHS, arma::vec &MCRHS) const override;
 
+  std::unique_ptr<Game::EPEC> makePortfolioCopy(GRBEnv *env) const override;
+
   void WriteCountry(const unsigned int i, const std::string filename,
                     const arma::vec x, const bool append = true) const;
 
@@ -289,7 +291,8 @@ public:                        // Attributes
   void readSolutionJSON(const std::string filename);
 
   void writeSolutionJSON(std::string filename, const arma::vec x,
-                         const arma::vec z) const;
+                         const arma::vec z, bool approximate = false,
+                         const std::vector<double> &regret = {}) const;
 
   void writeSolution(const int writeLevel, std::string filename) const;
 
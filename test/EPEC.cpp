@@ -328,6 +328,134 @@ BOOST_AUTO_TEST_CASE(LCP_test) {
   LCP lcp(&env, M, q, 1, 1, A, b);
 }
 
+BOOST_AUTO_TEST_CASE(LemkeLCP_test) {
+  /** Testing Lemke's method against the MIP formulation
+   *  M is positive definite, so the LCP has a single solution:
+   *x = (4/3, 7/3, 0), where the third equation is slack at 2
+   **/
+  BOOST_TEST_MESSAGE("Testing Game::LCP::solveLemke");
+  arma::sp_mat M(3, 3);
+  arma::vec q(3);
+  M(0, 0) = 2;
+  M(0, 1) = 1;
+  M(1, 0) = 1;
+  M(1, 1) = 2;
+  M(2, 2) = 1;
+  q(0) = -5;
+  q(1) = -6;
+  q(2) = 2;
+  const perps Compl{{0, 0}, {1, 1}, {2, 2}};
+  GRBEnv env;
+  LCP lcp(&env, M, q, Compl);
+  arma::vec z, x;
+  BOOST_REQUIRE_MESSAGE(lcp.solveLemke(z, x), "checking solveLemke");
+  auto model = lcp.LCPasMIP(true);
+  arma::vec zMIP, xMIP;
+  BOOST_REQUIRE_MESSAGE(lcp.extractSols(model.get(), zMIP, xMIP, true),
+                        "checking LCPasMIP");
+  BOOST_CHECK_CLOSE(x.at(0), 4.0 / 3, 1e-4);
+  BOOST_CHECK_CLOSE(x.at(1), 7.0 / 3, 1e-4);
+  BOOST_CHECK_SMALL(x.at(2), 1e-6);
+  BOOST_CHECK_CLOSE(z.at(2), 2, 1e-4);
+  for (unsigned int i = 0; i < 3; ++i)
+    BOOST_CHECK_SMALL(x.at(i) - xMIP.at(i), 1e-4);
+
+  // x0 <= 1 cuts off the only solution. Lemke's method does not pivot on
+  // these constraints, and gives up
+  arma::sp_mat A(1, 3);
+  A(0, 0) = 1;
+  LCP cut(&env, M, q, Compl, A, arma::vec{1});
+  BOOST_CHECK_MESSAGE(!cut.solveLemke(z, x),
+                      "checking that solveLemke gives up");
+}
+
+BOOST_AUTO_TEST_CASE(GuidedPoly_test) {
+  /** Testing the guided selection of polyhedra
+   *  TwoBlocksLCP has two feasible polyhedra: x0 = 1 and either x1 = 2 or
+   *x1 = 0. The first polyhedron added is the one agreeing with the guide
+   *point, and the next one is the other
+   **/
+  BOOST_TEST_MESSAGE("Testing Game::LCP::setGuidePoint");
+  GRBEnv env;
+  for (const arma::vec &guide : {arma::vec{1, 2, 0}, arma::vec{1, 0, 0}}) {
+    auto lcp = TwoBlocksLCP(&env, false);
+    auto expected = TwoBlocksLCP(&env, false);
+    bool ret{false};
+    expected->addPolyFromX(guide, ret);
+    BOOST_REQUIRE_MESSAGE(ret, "checking the polyhedron of the guide point");
+    lcp->setGuidePoint(guide);
+    lcp->addAPoly(1, Game::EPECAddPolyMethod::guided);
+    BOOST_CHECK_MESSAGE(lcp->getAllPolyhedra() == expected->getAllPolyhedra(),
+                        "checking that the closest polyhedron comes first");
+    lcp->addAPoly(1, Game::EPECAddPolyMethod::guided);
+    BOOST_CHECK_MESSAGE(lcp->conv_Npoly() == 2,
+                        "checking that the other polyhedron comes next");
+  }
+}
+
+BOOST_AUTO_TEST_CASE(NeighbourPolys_test) {
+  /** Testing the neighbours of a polyhedron
+   *  (1, 2, 0) lies in one of the two feasible polyhedra of TwoBlocksLCP. Its
+   *neighbours flip one complementarity each: one is the other feasible
+   *polyhedron, where x1 = 0, and one is infeasible, since x0 = 0 violates
+   *x0 - 1 >= 0
+   **/
+  BOOST_TEST_MESSAGE("Testing Game::LCP::getNeighbourPolys");
+  GRBEnv env;
+  std::vector<std::unique_ptr<GRBEnv>> workerEnvs{};
+  std::vector<GRBEnv *> envs{};
+  for (unsigned int w = 0; w < 2; ++w) {
+    workerEnvs.push_back(std::unique_ptr<GRBEnv>(new GRBEnv()));
+    envs.push_back(workerEnvs.back().get());
+  }
+  auto lcp = TwoBlocksLCP(&env, true);
+  const arma::vec x{1, 2, 0};
+  bool ret{false};
+  lcp->addPolyFromX(x, ret);
+  BOOST_REQUIRE_MESSAGE(ret, "checking the polyhedron of (1, 2, 0)");
+  const auto neighbours = lcp->getNeighbourPolys(x, {});
+  BOOST_CHECK_MESSAGE(neighbours.size() == 2, "checking the neighbours");
+  const auto feasible = lcp->checkPolyFeas(neighbours, envs);
+  BOOST_REQUIRE_MESSAGE(feasible.size() == 1,
+                        "checking the feasible neighbours");
+  BOOST_CHECK_MESSAGE(feasible.front() == lcp->polyFromX({1, 0, 0}),
+                      "checking the feasible neighbour");
+  BOOST_CHECK_MESSAGE(lcp->addThePoly(feasible.front()),
+                      "checking that the neighbour is added");
+  BOOST_CHECK_MESSAGE(lcp->getNeighbourPolys(x, {}).empty(),
+                      "checking that the neighbours are all explored");
+}
+
+BOOST_AUTO_TEST_CASE(Deadline_test) {
+  /** Testing the wall-clock deadline
+   **/
+  BOOST_TEST_MESSAGE("Testing Game::Deadline");
+  Game::Deadline deadline;
+  BOOST_CHECK_MESSAGE(!deadline.isActive() && !deadline.expired(),
+                      "checking an unset deadline");
+  BOOST_CHECK_EQUAL(deadline.remaining(), -1);
+  deadline.set(0.3);
+  BOOST_CHECK_MESSAGE(deadline.isActive() && !deadline.expired(),
+                      "checking a set deadline");
+  BOOST_CHECK_MESSAGE(deadline.remaining() > 0 && deadline.remaining() <= 0.3,
+                      "checking the time left");
+  GRBEnv env;
+  GRBModel model(env);
+  model.set(GRB_DoubleParam_TimeLimit, 100);
+  deadline.apply(model);
+  BOOST_CHECK_MESSAGE(model.get(GRB_DoubleParam_TimeLimit) <= 0.3,
+                      "checking the time limit of the model");
+  std::this_thread::sleep_for(std::chrono::milliseconds(400));
+  BOOST_CHECK_MESSAGE(deadline.expired(), "checking an expired deadline");
+  BOOST_CHECK_EQUAL(deadline.remaining(), 0);
+  deadline.set(-1);
+  BOOST_CHECK_MESSAGE(!deadline.isActive() && !deadline.expired(),
+                      "checking a cleared deadline");
+  deadline.cancel();
+  BOOST_CHECK_MESSAGE(deadline.expired(), "checking a cancelled deadline");
+  BOOST_CHECK_EQUAL(deadline.remaining(), 0);
+}
+
 BOOST_AUTO_TEST_CASE(ConvexHull_test) {
 
   /** Testing the convexHull method
@@ -451,6 +579,99 @@ BOOST_AUTO_TEST_CASE(IndicatorConstraints_test) {
   testEPECInstance(SimpleBlu(), allAlgo(common, true));
 }
 
+BOOST_AUTO_TEST_CASE(LCPBlocks_test) {
+  /** Testing the block decomposition of the LCP
+   *  The complementarities 0 <= x0 - 1 _|_ x0 >= 0 and
+   *0 <= 2 - x1 _|_ x1 >= 0 give 1 and 2 feasible polyhedra, so the LCP has 2.
+   *They form two blocks, unless a common constraint links x0 and x1
+   **/
+  BOOST_TEST_MESSAGE("Testing Game::LCP::getBlocks");
+  GRBEnv env;
+  for (const bool coupled : {false, true}) {
+    auto lcp = TwoBlocksLCP(&env, coupled);
+    const unsigned int nBlocks = coupled ? 1 : 2;
+    BOOST_CHECK_MESSAGE(lcp->getBlocks().size() == nBlocks,
+                        "checking the number of blocks");
+    // Block-wise enumeration if uncoupled, brute force otherwise
+    lcp->EnumerateAll(true);
+    BOOST_CHECK_MESSAGE(lcp->conv_Npoly() == 2,
+                        "checking the number of feasible polyhedra");
+  }
+}
+
+BOOST_AUTO_TEST_CASE(PolyFromX_test) {
+  /** Testing the polyhedra containing a point
+   *  (1, 2, 0) and (1, 0, 0) lie in the two distinct feasible polyhedra of
+   *TwoBlocksLCP
+   **/
+  BOOST_TEST_MESSAGE("Testing Game::LCP::polyFromX");
+  GRBEnv env;
+  auto lcp = TwoBlocksLCP(&env, false);
+  const arma::vec x1{1, 2, 0}, x2{1, 0, 0};
+  BOOST_CHECK_MESSAGE(lcp->polyFromX(x1) != lcp->polyFromX(x2),
+                      "checking that the polyhedra differ");
+  bool ret{false};
+  lcp->addPolyFromX(x1, ret);
+  BOOST_CHECK_MESSAGE(ret, "checking that the polyhedron is added");
+  BOOST_CHECK_MESSAGE(lcp->getAllPolyhedra().count(lcp->polyFromX(x1)) == 1,
+                      "checking the encoding of the polyhedron added");
+  lcp->addPolyFromX(x1, ret);
+  BOOST_CHECK_MESSAGE(!ret, "checking that the polyhedron is added once");
+  BOOST_CHECK_MESSAGE(lcp->addThePoly(lcp->polyFromX(x2)),
+                      "checking that the second polyhedron is feasible");
+  BOOST_CHECK_MESSAGE(lcp->conv_Npoly() == 2, "checking conv_Npoly==2");
+}
+
+BOOST_AUTO_TEST_CASE(BatchPolyFeas_test) {
+  /** Testing the parallel feasibility check of a batch of polyhedra
+   *  On the two blocks of TwoBlocksLCP, the workers check the fixes of each
+   *block, and settle the same polyhedra as the one-at-a-time check
+   **/
+  BOOST_TEST_MESSAGE("Testing Game::LCP::checkPolyFeas on a batch");
+  GRBEnv env, env1, env2;
+  const std::vector<unsigned long int> polys{0, 1, 2, 3};
+  auto batch = TwoBlocksLCP(&env, false);
+  auto single = TwoBlocksLCP(&env, false);
+  const auto feasible = batch->checkPolyFeas(polys, {&env1, &env2});
+  BOOST_CHECK_MESSAGE(feasible.size() == 2,
+                      "checking the number of feasible polyhedra");
+  for (const auto poly : polys)
+    BOOST_CHECK_MESSAGE(
+        single->checkPolyFeas(poly) ==
+            (std::find(feasible.begin(), feasible.end(), poly) !=
+             feasible.end()),
+        "checking polyhedron " << poly << " against checkPolyFeas");
+  for (const arma::vec x : {arma::vec{1, 2, 0}, arma::vec{1, 0, 0}})
+    BOOST_CHECK_MESSAGE(std::find(feasible.begin(), feasible.end(),
+                                  batch->polyFromX(x)) != feasible.end(),
+                        "checking the polyhedron of a feasible point");
+  BOOST_CHECK_MESSAGE(batch->checkPolyFeas(polys, {&env1, &env2}) == feasible,
+                      "checking the memoized outcomes");
+}
+
+BOOST_AUTO_TEST_CASE(DisjunctiveCut_test) {
+  /** Testing the lift-and-project cuts
+   *  x0 = 1 on the feasible region of TwoBlocksLCP, so (2, 2, 0) is cut off
+   *on its first complementarity. (1, 1, 0) is in the convex hull of the
+   *feasible region, and no cut separates it
+   **/
+  BOOST_TEST_MESSAGE("Testing Game::LCP::addDisjunctiveCut");
+  GRBEnv env;
+  auto lcp = TwoBlocksLCP(&env, false);
+  double violation{0};
+  BOOST_CHECK_MESSAGE(lcp->mostViolatedCompl({2, 2, 0}, violation) == 0,
+                      "checking the most violated complementarity");
+  BOOST_CHECK_CLOSE(violation, 1, 1e-4);
+  BOOST_CHECK_MESSAGE(lcp->addDisjunctiveCut({2, 2, 0}, 0),
+                      "checking that (2, 2, 0) is cut off");
+  BOOST_CHECK_MESSAGE(lcp->getNumCuts() == 1, "checking getNumCuts==1");
+  BOOST_CHECK_MESSAGE(!lcp->addDisjunctiveCut({1, 1, 0}, 1),
+                      "checking that (1, 1, 0) is not cut off");
+  BOOST_CHECK_MESSAGE(lcp->getNumCuts() == 1, "checking getNumCuts==1");
+  lcp->clearCuts();
+  BOOST_CHECK_MESSAGE(lcp->getNumCuts() == 0, "checking clearCuts");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(Models_Bilevel__Test)
@@ -520,6 +741,38 @@ BOOST_AUTO_TEST_CASE(Bilevel_PriceCapTaxCap_test) {
   testEPECInstance(SimpleBlu2, allAlgo(), TestType::resultCheck);
 }
 
+BOOST_AUTO_TEST_CASE(Bilevel_Decoupled_test) {
+  /** Testing the direct MPEC path (Game::EPEC::decoupledNash)
+   *  With a single country, every algorithm solves the MPEC once, in a single
+   *iteration, and finds a pure NE
+   **/
+  BOOST_TEST_MESSAGE("Testing a single bilevel problem solved directly.");
+  std::vector<Game::EPECAlgorithmParams> algorithms;
+  for (const auto algorithm :
+       {Game::EPECalgorithm::fullEnumeration,
+        Game::EPECalgorithm::innerApproximation,
+        Game::EPECalgorithm::combinatorialPNE,
+        Game::EPECalgorithm::outerApproximation,
+        Game::EPECalgorithm::bestResponseDynamics}) {
+    Game::EPECAlgorithmParams alg;
+    alg.algorithm = algorithm;
+    algorithms.push_back(alg);
+  }
+  for (auto const algorithm : algorithms) {
+    BOOST_TEST_MESSAGE(algorithmMessage(algorithm));
+    GRBEnv env;
+    Models::EPEC epec(&env);
+    solveEPECInstance(epec, SimpleBlu(), algorithm);
+    const auto stats = epec.getStatistics();
+    BOOST_CHECK_MESSAGE(stats.status == Game::EPECsolveStatus::nashEqFound,
+                        "checking the status");
+    BOOST_CHECK_MESSAGE(stats.numIteration == 1,
+                        "checking that the MPEC is solved once");
+    BOOST_CHECK_MESSAGE(stats.pureNE, "checking that the NE is pure");
+  }
+  testEPECInstance(SimpleBlu(), algorithms, TestType::resultCheck);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(Models_C1Fn__Tests)
@@ -677,8 +930,668 @@ BOOST_AUTO_TEST_CASE(HardToEnum2_test) {
   testEPECInstance(HardToEnum_2(), allAlgo());
 }
 
+BOOST_AUTO_TEST_CASE(TwoPhaseResponse_test) {
+  /** Testing the two-phase best response
+   *  The first phase only looks for a profitable deviation in the polyhedra
+   *known to be feasible, so the equilibria are the ones of the single-phase
+   *response. At most one deviation per country and iteration comes from it
+   **/
+  BOOST_TEST_MESSAGE("Testing the two-phase best response.");
+  Game::EPECAlgorithmParams algorithm;
+  algorithm.algorithm = Game::EPECalgorithm::innerApproximation;
+  algorithm.twoPhaseResponse = true;
+  for (const auto &inst : {C2F2_Base(), HardToEnum_1()}) {
+    GRBEnv env;
+    Models::EPEC epec(&env);
+    solveEPECInstance(epec, inst, algorithm);
+    const auto stats = epec.getStatistics();
+    BOOST_CHECK_MESSAGE(stats.status == Game::EPECsolveStatus::nashEqFound,
+                        "checking the status");
+    unsigned int cn;
+    arma::vec dev;
+    BOOST_CHECK_MESSAGE(epec.isSolved(&cn, &dev), "Invoking isSolved method.");
+    BOOST_CHECK_MESSAGE(stats.knownPolyDevns.size() ==
+                            inst.instance.Countries.size(),
+                        "checking the deviations of each country");
+    for (const unsigned int known : stats.knownPolyDevns)
+      BOOST_CHECK_MESSAGE(static_cast<int>(known) <= stats.numIteration,
+                          "checking the deviations in known polyhedra");
+  }
+  testEPECInstance(C2F2_Base(), {algorithm}, TestType::resultCheck);
+}
+
+BOOST_AUTO_TEST_CASE(DevnPool_test) {
+  /** Testing the deviation pool
+   *  HardToEnum1 has many polyhedra, and its best responses have improving
+   *solutions other than the optimal one. They are harvested from the pool
+   **/
+  BOOST_TEST_MESSAGE("Testing the pool of deviations.");
+  Game::EPECAlgorithmParams algorithm;
+  algorithm.algorithm = Game::EPECalgorithm::innerApproximation;
+  algorithm.devnPoolSize = 3;
+  GRBEnv env;
+  Models::EPEC epec(&env);
+  solveEPECInstance(epec, HardToEnum_1(), algorithm);
+  const auto stats = epec.getStatistics();
+  BOOST_CHECK_MESSAGE(stats.status == Game::EPECsolveStatus::nashEqFound,
+                      "checking the status");
+  unsigned int cn;
+  arma::vec dev;
+  BOOST_CHECK_MESSAGE(epec.isSolved(&cn, &dev), "Invoking isSolved method.");
+  BOOST_CHECK_MESSAGE(std::accumulate(stats.pooledDevns.begin(),
+                                      stats.pooledDevns.end(), 0u) > 0,
+                      "checking that the pool yields more deviations");
+  testEPECInstance(C2F2_Base(), {algorithm}, TestType::resultCheck);
+}
+
+BOOST_AUTO_TEST_CASE(MasterPool_test) {
+  /** Testing the pool of master solutions
+   *  The master LCPs of HardToEnum1 have equilibria with distinct supports,
+   *and the deviations from them are computed too
+   **/
+  BOOST_TEST_MESSAGE("Testing the pool of master solutions.");
+  Game::EPECAlgorithmParams algorithm;
+  algorithm.algorithm = Game::EPECalgorithm::innerApproximation;
+  algorithm.masterPoolSize = 3;
+  GRBEnv env;
+  Models::EPEC epec(&env);
+  solveEPECInstance(epec, HardToEnum_1(), algorithm);
+  const auto stats = epec.getStatistics();
+  BOOST_CHECK_MESSAGE(stats.status == Game::EPECsolveStatus::nashEqFound,
+                      "checking the status");
+  unsigned int cn;
+  arma::vec dev;
+  BOOST_CHECK_MESSAGE(epec.isSolved(&cn, &dev), "Invoking isSolved method.");
+  BOOST_CHECK_MESSAGE(stats.masterPoolSolutions > 0,
+                      "checking that the pool yields more master solutions");
+  testEPECInstance(C2F2_Base(), {algorithm}, TestType::resultCheck);
+}
+
+BOOST_AUTO_TEST_CASE(Pipelined_test) {
+  /** Testing the pipelined iterations
+   *  Solving twice resets the LCPs of the countries, which must stay in their
+   *own environments for the concurrent tasks of the second solve
+   **/
+  BOOST_TEST_MESSAGE("Testing the pipelined inner approximation.");
+  Game::EPECAlgorithmParams algorithm;
+  algorithm.algorithm = Game::EPECalgorithm::innerApproximation;
+  algorithm.pipelined = true;
+  for (const auto &inst : {C2F2_Base(), HardToEnum_1()}) {
+    GRBEnv env;
+    Models::EPEC epec(&env);
+    solveEPECInstance(epec, inst, algorithm);
+    for (unsigned int run = 0; run < 2; ++run) {
+      if (run > 0)
+        epec.findNashEq();
+      BOOST_CHECK_MESSAGE(epec.getStatistics().status ==
+                              Game::EPECsolveStatus::nashEqFound,
+                          "checking the status of solve " << run);
+      unsigned int cn;
+      arma::vec dev;
+      BOOST_CHECK_MESSAGE(epec.isSolved(&cn, &dev),
+                          "Invoking isSolved method.");
+    }
+  }
+  testEPECInstance(C2F2_Base(), {algorithm}, TestType::resultCheck);
+}
+
+BOOST_AUTO_TEST_CASE(MasterMIPStart_test) {
+  /** Testing the MIP start of the master LCP
+   *  The inner approximation only grows, so the equilibrium of the previous
+   *master stays feasible, and Gurobi turns it into an incumbent
+   **/
+  BOOST_TEST_MESSAGE("Testing the MIP start of the master LCP.");
+  Game::EPECAlgorithmParams algorithm;
+  algorithm.algorithm = Game::EPECalgorithm::innerApproximation;
+  algorithm.masterMIPStart = true;
+  GRBEnv env;
+  Models::EPEC epec(&env);
+  solveEPECInstance(epec, HardToEnum_1(), algorithm);
+  const auto stats = epec.getStatistics();
+  BOOST_CHECK_MESSAGE(stats.status == Game::EPECsolveStatus::nashEqFound,
+                      "checking the status");
+  unsigned int cn;
+  arma::vec dev;
+  BOOST_CHECK_MESSAGE(epec.isSolved(&cn, &dev), "Invoking isSolved method.");
+  BOOST_CHECK_MESSAGE(stats.masterStarts > 0, "checking the MIP starts");
+  BOOST_CHECK_MESSAGE(stats.masterStartsAccepted > 0,
+                      "checking that a MIP start is accepted");
+  BOOST_CHECK_MESSAGE(stats.masterStartsAccepted <= stats.masterStarts,
+                      "checking the MIP starts accepted");
+  testEPECInstance(C2F2_Base(), {algorithm}, TestType::resultCheck);
+}
+
+BOOST_AUTO_TEST_CASE(CombinatorialParallel_test) {
+  /** Testing the parallel search of the combinatorialPNE
+   *  One worker or several, the search settles the same instances, and the
+   *equilibria found are pure
+   **/
+  BOOST_TEST_MESSAGE("Testing the parallel combinatorialPNE.");
+  Game::EPECAlgorithmParams algorithm;
+  algorithm.algorithm = Game::EPECalgorithm::combinatorialPNE;
+  for (const auto &inst : {C2F2_Base(), HardToEnum_1()}) {
+    std::vector<Game::EPECsolveStatus> status;
+    for (const unsigned int threads : {1, TEST_NUM_THREADS}) {
+      algorithm.threads = threads;
+      GRBEnv env;
+      Models::EPEC epec(&env);
+      solveEPECInstance(epec, inst, algorithm);
+      const auto stats = epec.getStatistics();
+      status.push_back(stats.status);
+      if (stats.status != Game::EPECsolveStatus::nashEqFound)
+        continue;
+      BOOST_CHECK_MESSAGE(stats.pureNE, "checking that the NE is pure");
+      unsigned int cn;
+      arma::vec dev;
+      BOOST_CHECK_MESSAGE(epec.isSolved(&cn, &dev),
+                          "Invoking isSolved method.");
+    }
+    BOOST_CHECK_MESSAGE(status.front() == status.back(),
+                        "checking the status with " << TEST_NUM_THREADS
+                                                    << " workers");
+  }
+}
+
+BOOST_AUTO_TEST_CASE(CombinatorialPruning_test) {
+  /** Testing the pruning of the combinatorialPNE
+   *  With a single worker the search order is fixed, and the pruning only
+   *drops partial combinations that lead to no pure NE. Hence it settles the
+   *instances as the plain search, checking no more full combinations
+   **/
+  BOOST_TEST_MESSAGE("Testing the pruning of the combinatorialPNE.");
+  Game::EPECAlgorithmParams plain;
+  plain.algorithm = Game::EPECalgorithm::combinatorialPNE;
+  plain.threads = 1;
+  Game::EPECAlgorithmParams pruning = plain;
+  pruning.combinatorialPruning = true;
+  for (const auto &inst : {C2F2_Base(), HardToEnum_1()}) {
+    std::vector<Game::EPECStatistics> stats;
+    for (const auto &algorithm : {plain, pruning}) {
+      GRBEnv env;
+      Models::EPEC epec(&env);
+      solveEPECInstance(epec, inst, algorithm);
+      stats.push_back(epec.getStatistics());
+    }
+    BOOST_CHECK_MESSAGE(stats.front().prunedCombinations == 0,
+                        "checking that the plain search prunes nothing");
+    BOOST_CHECK_MESSAGE(stats.back().status == stats.front().status,
+                        "checking the status against the plain search");
+    BOOST_CHECK_MESSAGE(stats.back().evaluatedCombinations <=
+                            stats.front().evaluatedCombinations,
+                        "checking the full combinations checked");
+  }
+}
+
+BOOST_AUTO_TEST_CASE(HullCache_test) {
+  /** Testing the cache of convex hulls
+   *  In HardToEnum1, some iterations add no polyhedron to a country, whose
+   *hull is then taken from the cache. Without a cache, nothing is counted
+   **/
+  BOOST_TEST_MESSAGE("Testing the cache of convex hulls.");
+  Game::EPECAlgorithmParams algorithm;
+  algorithm.algorithm = Game::EPECalgorithm::innerApproximation;
+  for (const unsigned int size : {0, 8}) {
+    algorithm.hullCacheSize = size;
+    GRBEnv env;
+    Models::EPEC epec(&env);
+    solveEPECInstance(epec, HardToEnum_1(), algorithm);
+    const auto stats = epec.getStatistics();
+    BOOST_CHECK_MESSAGE(stats.status == Game::EPECsolveStatus::nashEqFound,
+                        "checking the status");
+    unsigned int cn;
+    arma::vec dev;
+    BOOST_CHECK_MESSAGE(epec.isSolved(&cn, &dev), "Invoking isSolved method.");
+    const unsigned int hits = std::accumulate(stats.hullCacheHits.begin(),
+                                              stats.hullCacheHits.end(), 0u);
+    if (size == 0)
+      BOOST_CHECK_MESSAGE(hits == 0, "checking that no hull is cached");
+    else
+      BOOST_CHECK_MESSAGE(hits > 0, "checking that cached hulls are reused");
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GuidedPolyMethod_test) {
+  /** Testing the inner approximation with the guided selection of polyhedra
+   **/
+  BOOST_TEST_MESSAGE("Testing the guided selection of polyhedra.");
+  Game::EPECAlgorithmParams algorithm;
+  algorithm.algorithm = Game::EPECalgorithm::innerApproximation;
+  algorithm.addPolyMethod = Game::EPECAddPolyMethod::guided;
+  for (const unsigned int aggressiveness : {1, 4}) {
+    algorithm.aggressiveness = aggressiveness;
+    testEPECInstance(C2F2_Base(), {algorithm}, TestType::resultCheck);
+    testEPECInstance(HardToEnum_1(), {algorithm}, TestType::simpleCheck);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(NeighbourExpansion_test) {
+  /** Testing the neighbour expansion of the inner approximation
+   *  The polyhedra around the support and the deviations are added up front,
+   *so the equilibria are found in no more iterations than without them
+   **/
+  BOOST_TEST_MESSAGE("Testing the neighbour expansion.");
+  Game::EPECAlgorithmParams plain;
+  plain.algorithm = Game::EPECalgorithm::innerApproximation;
+  Game::EPECAlgorithmParams expansion = plain;
+  expansion.neighbourExpansion = 2;
+  for (const auto &inst : {C2F2_Base(), HardToEnum_1()}) {
+    std::vector<Game::EPECStatistics> stats;
+    for (const auto &algorithm : {plain, expansion}) {
+      GRBEnv env;
+      Models::EPEC epec(&env);
+      solveEPECInstance(epec, inst, algorithm);
+      stats.push_back(epec.getStatistics());
+      BOOST_CHECK_MESSAGE(stats.back().status ==
+                              Game::EPECsolveStatus::nashEqFound,
+                          "checking the status");
+      unsigned int cn;
+      arma::vec dev;
+      BOOST_CHECK_MESSAGE(epec.isSolved(&cn, &dev),
+                          "Invoking isSolved method.");
+    }
+    BOOST_WARN_MESSAGE(stats.back().numIteration <=
+                           stats.front().numIteration,
+                       "checking the iterations against the plain run");
+  }
+  testEPECInstance(C2F2_Base(), {expansion}, TestType::resultCheck);
+}
+
+BOOST_AUTO_TEST_CASE(AdaptiveAggressiveness_test) {
+  /** Testing the adaptive aggressiveness
+   *  The common level stays within [1, max(8, 4 * aggressiveness)], and each
+   *country gets at most 1.5 times that
+   **/
+  BOOST_TEST_MESSAGE("Testing the adaptive aggressiveness.");
+  Game::EPECAlgorithmParams algorithm;
+  algorithm.algorithm = Game::EPECalgorithm::innerApproximation;
+  algorithm.adaptiveAggressiveness = true;
+  for (const unsigned int aggressiveness : {1, 4}) {
+    algorithm.aggressiveness = aggressiveness;
+    const double maxLevel = 1.5 * std::max(8u, 4 * aggressiveness);
+    for (const auto &inst : {C2F2_Base(), HardToEnum_1()}) {
+      GRBEnv env;
+      Models::EPEC epec(&env);
+      solveEPECInstance(epec, inst, algorithm);
+      const auto stats = epec.getStatistics();
+      BOOST_CHECK_MESSAGE(stats.status == Game::EPECsolveStatus::nashEqFound,
+                          "checking the status");
+      unsigned int cn;
+      arma::vec dev;
+      BOOST_CHECK_MESSAGE(epec.isSolved(&cn, &dev),
+                          "Invoking isSolved method.");
+      for (const auto &levels : stats.aggressivenessLog) {
+        BOOST_CHECK_MESSAGE(levels.size() == inst.instance.Countries.size(),
+                            "checking the level of each country");
+        for (const unsigned int level : levels)
+          BOOST_CHECK_MESSAGE(level >= 1 && level <= maxLevel,
+                              "checking the level " << level);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Continuation_test) {
+  /** Testing the tolerance continuation
+   *  The loose tolerances only drive the early iterations: an equilibrium is
+   *reported only once it is solved with the configured ones, and it is not
+   *flagged as approximate
+   **/
+  BOOST_TEST_MESSAGE("Testing the tolerance continuation.");
+  Game::EPECAlgorithmParams algorithm;
+  algorithm.algorithm = Game::EPECalgorithm::innerApproximation;
+  algorithm.continuationStart = 100;
+  for (const auto &inst : {C2F2_Base(), HardToEnum_1(), HardToEnum_2()}) {
+    GRBEnv env;
+    Models::EPEC epec(&env);
+    solveEPECInstance(epec, inst, algorithm);
+    const auto stats = epec.getStatistics();
+    BOOST_CHECK_MESSAGE(stats.status == Game::EPECsolveStatus::nashEqFound,
+                        "checking the status");
+    BOOST_CHECK_MESSAGE(!stats.approximate, "checking the equilibrium");
+    BOOST_CHECK_MESSAGE(epec.isSolved(algorithm.solvedTol),
+                        "checking the equilibrium with the final tolerance");
+  }
+  testEPECInstance(C2F2_Base(), {algorithm}, TestType::resultCheck);
+}
+
+BOOST_AUTO_TEST_CASE(Epsilon_test) {
+  /** Testing the epsilon-Nash equilibria
+   *  If the search stops at an epsilon-NE, the regret of each country is
+   *certified to be at most epsilon, and it is written to the JSON solution
+   **/
+  BOOST_TEST_MESSAGE("Testing the epsilon-Nash equilibria.");
+  const double epsilon{1e-3};
+  Game::EPECAlgorithmParams algorithm;
+  algorithm.algorithm = Game::EPECalgorithm::innerApproximation;
+  algorithm.epsilon = epsilon;
+  for (const auto &inst : {C2F2_Base(), HardToEnum_1()}) {
+    GRBEnv env;
+    Models::EPEC epec(&env);
+    solveEPECInstance(epec, inst, algorithm);
+    const auto stats = epec.getStatistics();
+    BOOST_CHECK_MESSAGE(stats.status == Game::EPECsolveStatus::nashEqFound,
+                        "checking the status");
+    if (!stats.approximate) {
+      unsigned int cn;
+      arma::vec dev;
+      BOOST_CHECK_MESSAGE(epec.isSolved(&cn, &dev),
+                          "Invoking isSolved method.");
+      continue;
+    }
+    BOOST_CHECK_MESSAGE(stats.certifiedRegret.size() ==
+                            inst.instance.Countries.size(),
+                        "checking the regret of each country");
+    for (const double regret : stats.certifiedRegret)
+      BOOST_CHECK_MESSAGE(regret <= epsilon, "checking the regret " << regret);
+    epec.writeSolution(0, "dat/EpsilonSolution");
+    std::ifstream file("dat/EpsilonSolution.json");
+    std::stringstream json;
+    json << file.rdbuf();
+    BOOST_CHECK_MESSAGE(json.str().find("\"Regret\"") != std::string::npos,
+                        "checking the regret in the JSON solution");
+  }
+}
+
+BOOST_AUTO_TEST_CASE(StopIncumbent_test) {
+  /** Testing the output of a stopped search (as on SIGINT)
+   *  A stop requested before the search leaves nothing to write. A stop
+   *requested during the search leaves the best profile seen, which is
+   *written as approximate, with its regret, without a pureness flag and
+   *without z
+   **/
+  BOOST_TEST_MESSAGE("Testing the stop requests and the incumbent.");
+  Game::EPECAlgorithmParams algorithm;
+  algorithm.algorithm = Game::EPECalgorithm::innerApproximation;
+  {
+    GRBEnv env;
+    Models::EPEC epec(&env);
+    Game::EPEC::requestStop();
+    solveEPECInstance(epec, HardToEnum_2(), algorithm);
+    Game::EPEC::clearStop();
+    BOOST_CHECK_MESSAGE(epec.getStatistics().status ==
+                            Game::EPECsolveStatus::timeLimit,
+                        "checking the status");
+    BOOST_CHECK_MESSAGE(!epec.hasIncumbent(), "checking the incumbent");
+  }
+  GRBEnv env;
+  Models::EPEC epec(&env);
+  auto stopper = std::async(std::launch::async, []() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    Game::EPEC::requestStop();
+  });
+  solveEPECInstance(epec, HardToEnum_2(), algorithm);
+  stopper.get();
+  Game::EPEC::clearStop();
+  const auto stats = epec.getStatistics();
+  if (stats.status == Game::EPECsolveStatus::nashEqFound) {
+    BOOST_TEST_MESSAGE("Solved before the stop request.");
+    return;
+  }
+  BOOST_CHECK_MESSAGE(stats.status == Game::EPECsolveStatus::timeLimit,
+                      "checking the status");
+  if (!epec.hasIncumbent())
+    return;
+  epec.writeSolution(0, "dat/IncumbentSolution");
+  std::ifstream file("dat/IncumbentSolution.json");
+  std::stringstream json;
+  json << file.rdbuf();
+  const auto has = [&json](const std::string &key) {
+    return json.str().find("\"" + key + "\"") != std::string::npos;
+  };
+  BOOST_CHECK_MESSAGE(json.str().find("\"isApproximate\": true") !=
+                          std::string::npos,
+                      "checking that the profile is approximate");
+  BOOST_CHECK_MESSAGE(has("Regret"), "checking the regret");
+  BOOST_CHECK_MESSAGE(!has("isPureEquilibrium"), "checking the pureness");
+  BOOST_CHECK_MESSAGE(has("x") && !has("z"), "checking the solution");
+}
+
+BOOST_AUTO_TEST_CASE(TimeLimit_test) {
+  /** Testing the global time limit
+   *  Every algorithm stops shortly after the time limit, and only reports an
+   *outcome it settled within it
+   **/
+  BOOST_TEST_MESSAGE("Testing the global time limit.");
+  const double timeLimit{1};
+  for (const auto algorithm : {Game::EPECalgorithm::fullEnumeration,
+                               Game::EPECalgorithm::innerApproximation,
+                               Game::EPECalgorithm::combinatorialPNE,
+                               Game::EPECalgorithm::outerApproximation}) {
+    Game::EPECAlgorithmParams alg;
+    alg.algorithm = algorithm;
+    alg.timeLimit = timeLimit;
+    BOOST_TEST_MESSAGE(algorithmMessage(alg));
+    GRBEnv env;
+    Models::EPEC epec(&env);
+    const double elapsed = solveEPECInstance(epec, HardToEnum_2(), alg);
+    BOOST_CHECK_MESSAGE(elapsed <= timeLimit + 5,
+                        "checking the time elapsed: " << elapsed);
+    const auto status = epec.getStatistics().status;
+    if (status == Game::EPECsolveStatus::nashEqFound) {
+      unsigned int cn;
+      arma::vec dev;
+      BOOST_CHECK_MESSAGE(epec.isSolved(&cn, &dev),
+                          "Invoking isSolved method.");
+    } else
+      BOOST_CHECK_MESSAGE(status != Game::EPECsolveStatus::numerical,
+                          "checking the status");
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Portfolio_test) {
+  /** Testing the portfolio of algorithms
+   *  The models of the winner are taken over, and must outlive a later solve
+   *that may have no winner
+   **/
+  BOOST_TEST_MESSAGE("Testing the portfolio of algorithms.");
+  Game::EPECAlgorithmParams algorithm;
+  algorithm.algorithm = Game::EPECalgorithm::portfolio;
+  for (const auto &inst : {C2F2_Base(), HardToEnum_1()}) {
+    GRBEnv env;
+    Models::EPEC epec(&env);
+    auto check = [&epec]() {
+      const auto stats = epec.getStatistics();
+      BOOST_CHECK_MESSAGE(stats.status == Game::EPECsolveStatus::nashEqFound,
+                          "checking the status");
+      BOOST_CHECK_MESSAGE(stats.portfolioWinner >= 0, "checking the winner");
+      unsigned int cn;
+      arma::vec dev;
+      BOOST_CHECK_MESSAGE(epec.isSolved(&cn, &dev),
+                          "Invoking isSolved method.");
+    };
+    solveEPECInstance(epec, inst, algorithm);
+    check();
+    // This solve may time out before any configuration wins
+    epec.setTimeLimit(0.2);
+    epec.findNashEq();
+    epec.setTimeLimit(-1);
+    epec.findNashEq();
+    check();
+  }
+  testEPECInstance(C2F2_Base(), {algorithm}, TestType::resultCheck);
+}
+
+BOOST_AUTO_TEST_CASE(OuterApproximation_test) {
+  /** Testing the outer approximation
+   *  Branching on the complementarities settles every instance as the full
+   *enumeration does, and any equilibrium found is one of the original game
+   **/
+  BOOST_TEST_MESSAGE("Testing the outer approximation.");
+  Game::EPECAlgorithmParams full;
+  full.algorithm = Game::EPECalgorithm::fullEnumeration;
+  Game::EPECAlgorithmParams outer;
+  outer.algorithm = Game::EPECalgorithm::outerApproximation;
+  for (const auto &inst : {C2F2_Base(), CH_S_F0_CL_SC_F0()}) {
+    GRBEnv env;
+    Models::EPEC reference(&env), epec(&env);
+    solveEPECInstance(reference, inst, full);
+    solveEPECInstance(epec, inst, outer);
+    const auto status = epec.getStatistics().status;
+    BOOST_CHECK_MESSAGE(status == reference.getStatistics().status,
+                        "checking the status against the full enumeration");
+    if (status == Game::EPECsolveStatus::nashEqFound) {
+      unsigned int cn;
+      arma::vec dev;
+      BOOST_CHECK_MESSAGE(epec.isSolved(&cn, &dev),
+                          "Invoking isSolved method.");
+    }
+  }
+  testEPECInstance(C2F2_Base(), {outer}, TestType::resultCheck);
+}
+
+BOOST_AUTO_TEST_CASE(DisjunctiveCuts_test) {
+  /** Testing the disjunctive cuts in the outer approximation
+   *  Each country keeps at most disjunctiveCuts cuts, counted afresh at every
+   *solve, and the cuts remove no equilibrium
+   **/
+  BOOST_TEST_MESSAGE("Testing the disjunctive cuts.");
+  Game::EPECAlgorithmParams algorithm;
+  algorithm.algorithm = Game::EPECalgorithm::outerApproximation;
+  algorithm.disjunctiveCuts = 5;
+  const testInst inst = C2F2_Base();
+  GRBEnv env;
+  Models::EPEC epec(&env);
+  solveEPECInstance(epec, inst, algorithm);
+  for (unsigned int run = 0; run < 2; ++run) {
+    if (run > 0)
+      epec.findNashEq();
+    const auto stats = epec.getStatistics();
+    BOOST_CHECK_MESSAGE(stats.status == Game::EPECsolveStatus::nashEqFound,
+                        "checking the status of solve " << run);
+    BOOST_CHECK_MESSAGE(stats.cutPoolSize.size() ==
+                            inst.instance.Countries.size(),
+                        "checking the number of cut pools");
+    for (const auto size : stats.cutPoolSize)
+      BOOST_CHECK_MESSAGE(size <= algorithm.disjunctiveCuts,
+                          "checking the size of the cut pool: " << size);
+  }
+  testEPECInstance(inst, {algorithm}, TestType::resultCheck);
+}
+
+BOOST_AUTO_TEST_CASE(BestResponseDynamics_test) {
+  /** Testing the best-response dynamics
+   *  Both update schemes, and a single round before the inner approximation
+   *takes over, settle every instance as the inner approximation does
+   **/
+  BOOST_TEST_MESSAGE("Testing the best-response dynamics.");
+  Game::EPECAlgorithmParams reference;
+  reference.algorithm = Game::EPECalgorithm::innerApproximation;
+  Game::EPECAlgorithmParams gaussSeidel;
+  gaussSeidel.algorithm = Game::EPECalgorithm::bestResponseDynamics;
+  Game::EPECAlgorithmParams jacobi = gaussSeidel;
+  jacobi.dynamics = Game::EPECDynamics::jacobi;
+  Game::EPECAlgorithmParams handOver = gaussSeidel;
+  handOver.dynamicsRounds = 1;
+  for (const auto &inst : {C2F2_Base(), CH_S_F0_CL_SC_F0(), HardToEnum_1()}) {
+    GRBEnv env;
+    Models::EPEC inner(&env);
+    solveEPECInstance(inner, inst, reference);
+    for (const auto &algorithm : {gaussSeidel, jacobi, handOver}) {
+      BOOST_TEST_MESSAGE(algorithmMessage(algorithm));
+      Models::EPEC epec(&env);
+      solveEPECInstance(epec, inst, algorithm);
+      const auto status = epec.getStatistics().status;
+      BOOST_CHECK_MESSAGE(status == inner.getStatistics().status,
+                          "checking the status against the inner "
+                          "approximation");
+      if (status == Game::EPECsolveStatus::nashEqFound) {
+        unsigned int cn;
+        arma::vec dev;
+        BOOST_CHECK_MESSAGE(epec.isSolved(&cn, &dev),
+                            "Invoking isSolved method.");
+      }
+    }
+  }
+  testEPECInstance(C2F2_Base(), {gaussSeidel, jacobi}, TestType::resultCheck);
+}
+
+BOOST_AUTO_TEST_CASE(MasterDecomposition_test) {
+  /** Testing the price coordination of the master LCP
+   *  Whether or not the decomposition converges, the master LCP falls back to
+   *its MIP, so the instances are settled as without the decomposition
+   **/
+  BOOST_TEST_MESSAGE("Testing the decomposition of the master LCP.");
+  Game::EPECAlgorithmParams reference;
+  reference.algorithm = Game::EPECalgorithm::innerApproximation;
+  Game::EPECAlgorithmParams algorithm = reference;
+  algorithm.masterDecomposition = 3;
+  for (const auto &inst : {C2F2_Base(), HardToEnum_1()}) {
+    GRBEnv env;
+    Models::EPEC inner(&env), epec(&env);
+    solveEPECInstance(inner, inst, reference);
+    BOOST_CHECK_MESSAGE(inner.getStatistics().decomposedMasters == 0,
+                        "checking that the decomposition is disabled");
+    solveEPECInstance(epec, inst, algorithm);
+    const auto status = epec.getStatistics().status;
+    BOOST_CHECK_MESSAGE(status == inner.getStatistics().status,
+                        "checking the status against the master MIP");
+    if (status == Game::EPECsolveStatus::nashEqFound) {
+      unsigned int cn;
+      arma::vec dev;
+      BOOST_CHECK_MESSAGE(epec.isSolved(&cn, &dev),
+                          "Invoking isSolved method.");
+    }
+  }
+  testEPECInstance(C2F2_Base(), {algorithm}, TestType::resultCheck);
+}
+
+BOOST_AUTO_TEST_CASE(SupportReduction_test) {
+  /** Testing the support reduction recover strategy
+   *  When the inner approximation finds a mixed NE, the pure NE is searched
+   *around its support first. The search widens if needed, so the instances
+   *are settled as with the combinatorial recover strategy
+   **/
+  BOOST_TEST_MESSAGE("Testing the support reduction recover strategy.");
+  Game::EPECAlgorithmParams combinatorial;
+  combinatorial.algorithm = Game::EPECalgorithm::innerApproximation;
+  combinatorial.pureNE = true;
+  combinatorial.recoverStrategy = Game::EPECRecoverStrategy::combinatorial;
+  Game::EPECAlgorithmParams reduction = combinatorial;
+  reduction.recoverStrategy = Game::EPECRecoverStrategy::supportReduction;
+  for (const auto &inst : {C2F2_Base(), HardToEnum_1(), HardToEnum_2()}) {
+    std::vector<Game::EPECStatistics> stats;
+    for (const auto &algorithm : {combinatorial, reduction}) {
+      GRBEnv env;
+      Models::EPEC epec(&env);
+      solveEPECInstance(epec, inst, algorithm);
+      stats.push_back(epec.getStatistics());
+      if (stats.back().status != Game::EPECsolveStatus::nashEqFound)
+        continue;
+      BOOST_CHECK_MESSAGE(stats.back().pureNE, "checking that the NE is pure");
+      unsigned int cn;
+      arma::vec dev;
+      BOOST_CHECK_MESSAGE(epec.isSolved(&cn, &dev),
+                          "Invoking isSolved method.");
+    }
+    BOOST_CHECK_MESSAGE(stats.back().status == stats.front().status,
+                        "checking the status against the combinatorial "
+                        "recover strategy");
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
+std::unique_ptr<Game::LCP> TwoBlocksLCP(GRBEnv *env, bool coupled) {
+  // 0 <= x0 - 1 _|_ x0 >= 0, 0 <= 2 - x1 _|_ x1 >= 0 and a leader x2 <= 5.
+  // If coupled, x0 + x1 <= 10 links the two complementarities
+  arma::sp_mat M(2, 3);
+  arma::vec q(2);
+  M(0, 0) = 1;
+  q(0) = -1;
+  M(1, 1) = -1;
+  q(1) = 2;
+  arma::sp_mat A(coupled ? 2 : 1, 3);
+  arma::vec b(coupled ? 2 : 1);
+  A(0, 2) = 1;
+  b(0) = 5;
+  if (coupled) {
+    A(1, 0) = 1;
+    A(1, 1) = 1;
+    b(1) = 10;
+  }
+  return std::unique_ptr<Game::LCP>(new Game::LCP(env, M, q, 2, 2, A, b));
+}
+
 Models::FollPar FP_Rosso() {
   Models::FollPar FP_Rosso;
   FP_Rosso.capacities = {550};
@@ -11,10 +11,15 @@
 #include <cstdlib>
 #include <ctime>
 #include <exception>
+#include <fstream>
+#include <future>
 #include <gurobi_c++.h>
 #include <iomanip>
 #include <iostream>
+#include <numeric>
 #include <random>
+#include <sstream>
+#include <thread>
 
 #define BOOST_TEST_MODULE EPECTest
 
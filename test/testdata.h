@@ -42,39 +42,74 @@ allAlgo(EPECAlgorithmParams common_params = {}, bool readCommonConfig = false) {
   return algs;
 }
 
+std::string algorithmMessage(const Game::EPECAlgorithmParams &algorithm) {
+  std::stringstream ss;
+  ss << "Algorithm: " << std::to_string(algorithm.algorithm);
+  if (algorithm.algorithm == Game::EPECalgorithm::innerApproximation) {
+    ss << "\nAggressiveness: " << algorithm.aggressiveness;
+    ss << "\nMethod to add polyhedra: "
+       << std::to_string(algorithm.addPolyMethod);
+  }
+  return ss.str();
+}
+
+double solveEPECInstance(Models::EPEC &epec, const testInst &inst,
+                         const Game::EPECAlgorithmParams &algorithm) {
+  // Adds the instance to epec, finalizes it and runs the algorithm.
+  // Returns the time elapsed in findNashEq
+  const unsigned int nCountr = inst.instance.Countries.size();
+  for (unsigned int i = 0; i < nCountr; i++)
+    epec.addCountry(inst.instance.Countries.at(i));
+  epec.addTranspCosts(inst.instance.TransportationCosts);
+  // The environments of the pipelined tasks are made by finalize
+  epec.setPipelined(algorithm.pipelined);
+  epec.finalize();
+
+  epec.setAlgorithm(algorithm.algorithm);
+  epec.setRecoverStrategy(algorithm.recoverStrategy);
+  epec.setAggressiveness(algorithm.aggressiveness);
+  epec.setAddPolyMethod(algorithm.addPolyMethod);
+  epec.setIndicators(algorithm.indicators);
+  epec.setNumThreads(algorithm.threads > 0 ? algorithm.threads
+                                           : TEST_NUM_THREADS);
+  epec.setAddPolyMethodSeed(algorithm.addPolyMethodSeed);
+  epec.setTimeLimit(algorithm.timeLimit);
+  epec.setPureNE(algorithm.pureNE);
+  epec.setTwoPhaseResponse(algorithm.twoPhaseResponse);
+  epec.setDevnPoolSize(algorithm.devnPoolSize);
+  epec.setMasterPoolSize(algorithm.masterPoolSize);
+  epec.setMasterMIPStart(algorithm.masterMIPStart);
+  epec.setCombinatorialPruning(algorithm.combinatorialPruning);
+  epec.setHullCacheSize(algorithm.hullCacheSize);
+  epec.setNeighbourExpansion(algorithm.neighbourExpansion);
+  epec.setAdaptiveAggressiveness(algorithm.adaptiveAggressiveness);
+  epec.setContinuationStart(algorithm.continuationStart);
+  epec.setEpsilon(algorithm.epsilon);
+  epec.setDisjunctiveCuts(algorithm.disjunctiveCuts);
+  epec.setMasterDecomposition(algorithm.masterDecomposition);
+  epec.setDynamics(algorithm.dynamics);
+  epec.setDynamicsRounds(algorithm.dynamicsRounds);
+
+  const std::chrono::high_resolution_clock::time_point initTime =
+      std::chrono::high_resolution_clock::now();
+  epec.findNashEq();
+  const std::chrono::duration<double> timeElapsed =
+      std::chrono::high_resolution_clock::now() - initTime;
+  return timeElapsed.count();
+}
+
 void testEPECInstance(const testInst inst,
                       const std::vector<Game::EPECAlgorithmParams> algorithms,
                       TestType check_type = TestType::resultCheck) {
   BOOST_TEST_MESSAGE("*** NEW INSTANCE ***");
   for (auto const algorithm : algorithms) {
     std::stringstream ss;
-    ss << "Algorithm: " << std::to_string(algorithm.algorithm);
-    if (algorithm.algorithm == Game::EPECalgorithm::innerApproximation) {
-      ss << "\nAggressiveness: " << algorithm.aggressiveness;
-      ss << "\nMethod to add polyhedra: "
-         << std::to_string(algorithm.addPolyMethod);
-    }
+    ss << algorithmMessage(algorithm);
     BOOST_TEST_MESSAGE(ss.str());
     GRBEnv env;
     Models::EPEC epec(&env);
     const unsigned int nCountr = inst.instance.Countries.size();
-    for (unsigned int i = 0; i < nCountr; i++)
-      epec.addCountry(inst.instance.Countries.at(i));
-    epec.addTranspCosts(inst.instance.TransportationCosts);
-    epec.finalize();
-
-    epec.setAlgorithm(algorithm.algorithm);
-    epec.setAggressiveness(algorithm.aggressiveness);
-    epec.setAddPolyMethod(algorithm.addPolyMethod);
-    epec.setIndicators(algorithm.indicators);
-    epec.setNumThreads(TEST_NUM_THREADS );
-    epec.setAddPolyMethodSeed(algorithm.addPolyMethodSeed);
-
-    const std::chrono::high_resolution_clock::time_point initTime =
-        std::chrono::high_resolution_clock::now();
-    epec.findNashEq();
-    const std::chrono::duration<double> timeElapsed =
-        std::chrono::high_resolution_clock::now() - initTime;
+    const double timeElapsed = solveEPECInstance(epec, inst, algorithm);
 
     switch (check_type) {
     case TestType::simpleCheck: {
@@ -121,7 +156,7 @@ void testEPECInstance(const testInst inst,
     }
     }
 
-    ss << "\n Successfully completed running in time: " << timeElapsed.count();
+    ss << "\n Successfully completed running in time: " << timeElapsed;
     BOOST_TEST_MESSAGE(ss.str());
   }
 }
@@ -132,6 +167,7 @@ testInst HardToEnum_2();
 testInst SimpleBlu();
 testInst SimpleVerde();
 testInst SimpleViola();
+std::unique_ptr<Game::LCP> TwoBlocksLCP(GRBEnv *env, bool coupled);
 // Getting Follower parameter
 Models::FollPar FP_Rosso();
 Models::FollPar FP_Bianco();